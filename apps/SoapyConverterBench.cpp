@@ -0,0 +1,100 @@
+// Copyright (c) 2021-2021 Josh Blum
+// SPDX-License-Identifier: BSL-1.0
+
+#include <SoapySDR/ConverterRegistry.hpp>
+#include <SoapySDR/Formats.hpp>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <cstdio>
+#include <iostream>
+#include <chrono>
+#include <algorithm> //max
+
+//! Minimum time spent converting for each measurement
+static const std::chrono::milliseconds MIN_BENCH_TIME(50);
+
+//! Bytes of source plus target per buffer, from L1-resident to DRAM-sized
+static const size_t BENCH_BUFF_BYTES[] = {16*1024, 256*1024, 4*1024*1024, 64*1024*1024};
+
+static std::string priorityToString(const SoapySDR::ConverterRegistry::FunctionPriority priority)
+{
+    switch (priority)
+    {
+    case SoapySDR::ConverterRegistry::GENERIC: return "GENERIC";
+    case SoapySDR::ConverterRegistry::VECTORIZED: return "VECTORIZED";
+    case SoapySDR::ConverterRegistry::CUSTOM: return "CUSTOM";
+    }
+    return std::to_string(int(priority));
+}
+
+static std::string bytesToString(const size_t bytes)
+{
+    if (bytes >= 1024*1024) return std::to_string(bytes/(1024*1024)) + " MiB";
+    return std::to_string(bytes/1024) + " KiB";
+}
+
+/*!
+ * Time a converter over one buffer size.
+ * The conversion is repeated until the minimum time elapses,
+ * and the rate is computed over all of the repetitions.
+ * \return the number of elements converted per second
+ */
+static double benchConverter(
+    const SoapySDR::ConverterRegistry::ConverterFunction function,
+    const void *srcBuff, void *dstBuff, const size_t numElems)
+{
+    //warm up the caches and the page tables
+    function(srcBuff, dstBuff, numElems, 1.0);
+
+    size_t numIters(0);
+    const auto startTime = std::chrono::high_resolution_clock::now();
+    auto elapsed = std::chrono::high_resolution_clock::duration::zero();
+    do
+    {
+        function(srcBuff, dstBuff, numElems, 1.0);
+        numIters++;
+        elapsed = std::chrono::high_resolution_clock::now() - startTime;
+    } while (elapsed < MIN_BENCH_TIME);
+
+    const double seconds = std::chrono::duration<double>(elapsed).count();
+    return (numIters*numElems)/seconds;
+}
+
+int SoapySDRConverterBench(const std::string &formatStr)
+{
+    size_t maxBuffBytes(0);
+    for (const auto bytes : BENCH_BUFF_BYTES) maxBuffBytes = std::max(maxBuffBytes, bytes);
+    std::vector<char> srcMem(maxBuffBytes), dstMem(maxBuffBytes);
+
+    std::cout << "Benchmark converters";
+    if (not formatStr.empty()) std::cout << " for " << formatStr;
+    std::cout << "..." << std::endl;
+    printf("%-6s %-6s %-10s %8s %12s %12s\n", "Source", "Target", "Priority", "Buffer", "MElems/s", "MB/s");
+
+    for (const auto &source : SoapySDR::ConverterRegistry::listAvailableSourceFormats())
+    {
+        for (const auto &target : SoapySDR::ConverterRegistry::listTargetFormats(source))
+        {
+            if (not formatStr.empty() and formatStr != source and formatStr != target) continue;
+            const size_t elemBytes = SoapySDR::formatToSize(source) + SoapySDR::formatToSize(target);
+            if (elemBytes == 0) continue; //custom format of unknown size
+
+            for (const auto priority : SoapySDR::ConverterRegistry::listPriorities(source, target))
+            {
+                const auto function = SoapySDR::ConverterRegistry::getFunction(source, target, priority);
+                for (const auto bytes : BENCH_BUFF_BYTES)
+                {
+                    const size_t numElems = bytes/elemBytes;
+                    const double rate = benchConverter(function, srcMem.data(), dstMem.data(), numElems);
+                    printf("%-6s %-6s %-10s %8s %12.1f %12.1f\n",
+                        source.c_str(), target.c_str(), priorityToString(priority).c_str(),
+                        bytesToString(bytes).c_str(), rate/1e6, (rate*elemBytes)/1e6);
+                    fflush(stdout);
+                }
+            }
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
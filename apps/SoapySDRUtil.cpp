@@ -32,6 +32,7 @@ int SoapySDRRateTest(
     const std::string &formatStr,
     const std::string &channelStr,
     const std::string &directionStr);
+int SoapySDRConverterBench(const std::string &formatStr);
 
 /***********************************************************************
  * Print the banner
@@ -72,6 +73,10 @@ static int printHelp(void)
     std::cout << "    --channels[=\"0, 1, 2\"] \t\t List of channels, default 0" << std::endl;
     std::cout << "    --direction[=RX or TX] \t\t Specify the channel direction" << std::endl;
     std::cout << std::endl;
+
+    std::cout << "  Converter options:" << std::endl;
+    std::cout << "    --bench-converters[=CS16|CF32|...] \t Time the registered converters" << std::endl;
+    std::cout << std::endl;
     return EXIT_SUCCESS;
 }
 
@@ -295,6 +300,7 @@ int main(int argc, char *argv[])
     bool makeDeviceFlag(false);
     bool probeDeviceFlag(false);
     bool watchDeviceFlag(false);
+    bool benchConvertersFlag(false);
 
     /*******************************************************************
      * parse command line options
@@ -316,6 +322,8 @@ int main(int argc, char *argv[])
         {"format", optional_argument, nullptr, 't'},
         {"channels", optional_argument, nullptr, 'n'},
         {"direction", optional_argument, nullptr, 'd'},
+
+        {"bench-converters", optional_argument, nullptr, 'b'},
         {nullptr, no_argument, nullptr, '\0'}
     };
     int long_index = 0;
@@ -370,6 +378,10 @@ int main(int argc, char *argv[])
         case 'd':
             if (optarg != nullptr) dirStr = optarg;
             break;
+        case 'b':
+            benchConvertersFlag = true;
+            if (optarg != nullptr) formatStr = optarg;
+            break;
         }
     }
 
@@ -387,6 +399,7 @@ int main(int argc, char *argv[])
     if (makeDeviceFlag)  return makeDevice(argStr);
     if (probeDeviceFlag) return probeDevice(argStr);
     if (watchDeviceFlag) return watchDevice(argStr);
+    if (benchConvertersFlag) return SoapySDRConverterBench(formatStr);
 
     //invoke utilities that rely on multiple arguments
     if (sampleRate != 0.0)
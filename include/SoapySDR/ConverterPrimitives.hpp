@@ -10,6 +10,8 @@
 
 #pragma once
 #include <stdint.h>
+#include <cmath> //lrint
+#include <limits>
 
 namespace SoapySDR
 {
@@ -28,30 +30,64 @@ const uint8_t   S8_FULL_SCALE =  uint8_t(1<<7);
  * \return the converted value
  */
 
+// truncating conversion: float > integers
+// the value is truncated toward zero, and out of range values clamp
+// to the integer range instead of wrapping (NaN clamps to the minimum)
+
+template <typename IntType, typename FloatType>
+inline IntType FloatToInt(FloatType from){
+  if (from >= FloatType(std::numeric_limits<IntType>::max())) return std::numeric_limits<IntType>::max();
+  if (not (from > FloatType(std::numeric_limits<IntType>::min()))) return std::numeric_limits<IntType>::min();
+  return IntType(from);
+}
+
 // type conversion: float <> signed integers
 
 inline int32_t F32toS32(float from){
-  return int32_t(from * S32_FULL_SCALE);
+  return FloatToInt<int32_t>(from * S32_FULL_SCALE);
 }
 inline float S32toF32(int32_t from){
   return float(from) / S32_FULL_SCALE;
 }
 
 inline int16_t F32toS16(float from){
-  return int16_t(from * S16_FULL_SCALE);
+  return FloatToInt<int16_t>(from * S16_FULL_SCALE);
 }
 inline float S16toF32(int16_t from){
   return float(from) / S16_FULL_SCALE;
 }
 
 inline int8_t F32toS8(float from){
-  return int8_t(from * S8_FULL_SCALE);
+  return FloatToInt<int8_t>(from * S8_FULL_SCALE);
 }
 inline float S8toF32(int8_t from){
   return float(from) / S8_FULL_SCALE;
 }
 
 
+// type conversion: double <> signed integers
+
+inline int32_t F64toS32(double from){
+  return FloatToInt<int32_t>(from * S32_FULL_SCALE);
+}
+inline double S32toF64(int32_t from){
+  return double(from) / S32_FULL_SCALE;
+}
+
+inline int16_t F64toS16(double from){
+  return FloatToInt<int16_t>(from * S16_FULL_SCALE);
+}
+inline double S16toF64(int16_t from){
+  return double(from) / S16_FULL_SCALE;
+}
+
+inline int8_t F64toS8(double from){
+  return FloatToInt<int8_t>(from * S8_FULL_SCALE);
+}
+inline double S8toF64(int8_t from){
+  return double(from) / S8_FULL_SCALE;
+}
+
 // type conversion: offset binary <> two's complement (signed) integers
 
 inline int32_t U32toS32(uint32_t from){
@@ -94,7 +130,49 @@ inline int16_t S8toS16(int8_t from){
   return int16_t(from << 8);
 }
 
-// compound conversions
+// saturating conversion: float > signed integers
+// the value is rounded to nearest, and out of range values clamp
+// to the integer range instead of wrapping (NaN clamps to the minimum)
+
+inline int16_t F32toS16Saturating(float from){
+  const float scaled = from * S16_FULL_SCALE;
+  if (scaled >= float(INT16_MAX)) return INT16_MAX;
+  if (not (scaled > float(INT16_MIN))) return INT16_MIN;
+  return int16_t(std::lrint(scaled));
+}
+
+inline int8_t F32toS8Saturating(float from){
+  const float scaled = from * S8_FULL_SCALE;
+  if (scaled >= float(INT8_MAX)) return INT8_MAX;
+  if (not (scaled > float(INT8_MIN))) return INT8_MIN;
+  return int8_t(std::lrint(scaled));
+}
+
+// byte order: big endian <> host order (the swap is its own inverse)
+
+inline int16_t S16BEtoS16(int16_t from){
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+  return from;
+#else
+  return int16_t((uint16_t(from) >> 8) | (uint16_t(from) << 8));
+#endif
+}
+inline int16_t S16toS16BE(int16_t from){
+  return S16BEtoS16(from);
+}
+
+inline int32_t S32BEtoS32(int32_t from){
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+  return from;
+#else
+  const uint32_t u = uint32_t(from);
+  return int32_t((u >> 24) | ((u >> 8) & 0xff00) | ((u << 8) & 0xff0000) | (u << 24));
+#endif
+}
+inline int32_t S32toS32BE(int32_t from){
+  return S32BEtoS32(from);
+}
+
 
 // float <> unsigned (type and size)
 
@@ -119,6 +197,10 @@ inline float U8toF32(uint8_t from){
   return S8toF32(U8toS8(from));
 }
 
+inline uint8_t F32toU8Saturating(float from){
+  return S8toU8(F32toS8Saturating(from));
+}
+
 // signed <> unsigned (type and size)
 
 inline uint16_t S32toU16(int32_t from){
@@ -149,5 +231,50 @@ inline int8_t U16toS8(uint16_t from){
   return S16toS8(U16toS16(from));
 }
 
+/*!
+ * Conversion Primitives for packed complex formats.
+ * CS12 packs I and Q as two little endian 12-bit values in 3 bytes,
+ * and CS4 packs I into the low nibble and Q into the high nibble of 1 byte.
+ * The unpacked values are MSB aligned into CS16 and CS8 respectively.
+ * \param from pointer to the packed or unpacked complex value
+ * \param to pointer to the converted complex value
+ */
+
+// packed complex: CS12 <> CS16
+
+inline void CS12toCS16(const uint8_t *from, int16_t *to){
+  to[0] = int16_t((uint16_t(from[1]) << 12) | (uint16_t(from[0]) << 4));
+  to[1] = int16_t((uint16_t(from[2]) << 8) | (uint16_t(from[1]) & 0xf0));
+}
+inline void CS16toCS12(const int16_t *from, uint8_t *to){
+  to[0] = uint8_t(uint16_t(from[0]) >> 4);
+  to[1] = uint8_t((uint16_t(from[1]) & 0xf0) | (uint16_t(from[0]) >> 12));
+  to[2] = uint8_t(uint16_t(from[1]) >> 8);
+}
+
+// packed complex: CF32 > CS12, rounded and clamped to 12 bits,
+// which are MSB aligned into 16 bits as in CS12toCS16()
+
+inline int16_t F32toS12Saturating(float from){
+  const float scaled = from * (S16_FULL_SCALE >> 4);
+  if (scaled >= 2047.0f) return int16_t(2047 * 16);
+  if (not (scaled > -2048.0f)) return int16_t(-2048 * 16);
+  return int16_t(std::lrint(scaled) * 16);
+}
+inline void CF32toCS12Saturating(const float *from, uint8_t *to){
+  const int16_t tmp[2] = {F32toS12Saturating(from[0]), F32toS12Saturating(from[1])};
+  CS16toCS12(tmp, to);
+}
+
+// packed complex: CS4 <> CS8
+
+inline void CS4toCS8(const uint8_t from, int8_t *to){
+  to[0] = int8_t(uint8_t(from << 4));
+  to[1] = int8_t(from & 0xf0);
+}
+inline uint8_t CS8toCS4(const int8_t *from){
+  return uint8_t((uint8_t(from[0]) >> 4) | (uint8_t(from[1]) & 0xf0));
+}
+
 
 }
@@ -14,6 +14,8 @@
 #include <SoapySDR/Logger.hpp>
 #include <SoapySDR/Formats.hpp>
 #include <utility>
+#include <functional>
+#include <complex>
 #include <vector>
 #include <map>
 #include <string>
@@ -38,9 +40,87 @@ namespace SoapySDR
      * A converter function copies and optionally converts an input buffer of one format into an
      * output buffer of another format.
      * The parameters are (input pointer, output pointer, number of elements, optional scalar)
+     *
+     * When the target element is not larger than the source element,
+     * a converter must also convert in place, with the same input and output pointer.
+     * Each block of input is read before its output is written,
+     * so the output never overwrites input which was not converted yet.
      */
     typedef void (*ConverterFunction)(const void *, void *, const size_t, const double);
 
+    /*!
+     * A typedef for declaring a DeinterleaveFunction to be maintained in the ConverterRegistry.
+     * A deinterleave function converts a buffer of numElems*numChans channel-interleaved elements
+     * of the source format into numChans planar buffers of numElems elements of the target format.
+     * Splitting a complex format into planar I and Q buffers is a deinterleave of the
+     * real format with two channels, ex: CS16 to planar F32 is S16 to F32 with numChans=2.
+     * The parameters are (input pointer, output pointers, number of channels, number of elements, optional scalar)
+     */
+    typedef void (*DeinterleaveFunction)(const void *, void * const *, const size_t, const size_t, const double);
+
+    /*!
+     * A typedef for declaring an InterleaveFunction to be maintained in the ConverterRegistry.
+     * An interleave function is the inverse of a deinterleave function: it converts numChans
+     * planar buffers of numElems elements of the source format into a buffer of
+     * numElems*numChans channel-interleaved elements of the target format.
+     * The parameters are (input pointers, output pointer, number of channels, number of elements, optional scalar)
+     */
+    typedef void (*InterleaveFunction)(const void * const *, void *, const size_t, const size_t, const double);
+
+    /*!
+     * Correction parameters for converters which also correct the front end.
+     * The complex output sample is matrix * (scaler * x - dcOffset),
+     * where x is the input sample converted to the target format.
+     * The default parameters leave the samples uncorrected.
+     */
+    struct SOAPY_SDR_API Correction
+    {
+      //! Create an identity correction
+      Correction(void);
+
+      //! The DC offset removed from the scaled sample
+      std::complex<double> dcOffset;
+
+      //! The IQ correction matrix, row major: [I, Q] = matrix * [I, Q]
+      double matrix[2][2];
+    };
+
+    /*!
+     * A typedef for declaring a CorrectionFunction to be maintained in the ConverterRegistry.
+     * A correction function converts a complex input buffer like a ConverterFunction,
+     * and applies the DC offset and IQ correction to each sample in the same pass.
+     * The parameters are (input pointer, output pointer, number of elements, optional scalar, correction)
+     */
+    typedef void (*CorrectionFunction)(const void *, void *, const size_t, const double, const Correction &);
+
+    /*!
+     * Signal statistics filled by a StatisticsFunction while converting.
+     * The statistics describe the samples of a single call,
+     * so a monitor can check every buffer without a second pass.
+     */
+    struct SOAPY_SDR_API Statistics
+    {
+      //! Create empty statistics
+      Statistics(void);
+
+      //! The largest magnitude of an output sample
+      double peak;
+
+      //! The mean power of the output samples, the mean of |x|^2
+      double meanPower;
+
+      //! The number of input samples with I or Q at the limit of the source format
+      size_t clipCount;
+    };
+
+    /*!
+     * A typedef for declaring a StatisticsFunction to be maintained in the ConverterRegistry.
+     * A statistics function converts a complex input buffer like a ConverterFunction,
+     * and fills the statistics of the buffer in the same pass.
+     * The parameters are (input pointer, output pointer, number of elements, optional scalar, statistics)
+     */
+    typedef void (*StatisticsFunction)(const void *, void *, const size_t, const double, Statistics &);
+
     /*!
      * FunctionPriority: allow selection of a converter function with a given source and target format.
      */
@@ -50,6 +130,17 @@ namespace SoapySDR
       CUSTOM = 5            //!< Custom user re-implementation. Max priority.
     };
 
+    /*!
+     * FunctionVariant: select the overflow or memory behavior of a converter function.
+     * Each variant has its own set of priorities for a source and target format.
+     * The name WRAPPING is historical: no variant wraps on overflow.
+     */
+    enum FunctionVariant{
+      WRAPPING = 0,         //!< Float to integer conversions truncate toward zero and clamp to the integer range. The default.
+      SATURATING = 1,       //!< Float to integer conversions round to nearest and clamp to the integer range.
+      STREAMING = 2         //!< Like WRAPPING (the default), but the output is written with non-temporal stores which bypass the cache.
+    };
+
     /*!
      * TargetFormatConverterPriority: a map of possible conversion functions for a given Priority.
      * Maintained by the registry.
@@ -79,6 +170,67 @@ namespace SoapySDR
      * \param converter function to register
      */
     ConverterRegistry(const std::string &sourceFormat, const std::string &targetFormat, const FunctionPriority &priority, ConverterFunction converter);
+
+    /*!
+     * Class constructor. Registers a ConverterFunction with a
+     * given source format, target format, priority, and variant.
+     *
+     * refuses to register converter and logs error if a source/target/priority entry already exists
+     * \param sourceFormat the source format markup string
+     * \param targetFormat the target format markup string
+     * \param priority the FunctionPriority of the converter to register
+     * \param variant the FunctionVariant implemented by the converter
+     * \param converter function to register
+     */
+    ConverterRegistry(const std::string &sourceFormat, const std::string &targetFormat, const FunctionPriority &priority, const FunctionVariant &variant, ConverterFunction converter);
+
+    /*!
+     * Class constructor. Registers a DeinterleaveFunction with a
+     * given source format, target format, and priority.
+     *
+     * refuses to register the function and logs error if a source/target/priority entry already exists
+     * \param sourceFormat the format markup string of the interleaved input
+     * \param targetFormat the format markup string of the planar outputs
+     * \param priority the FunctionPriority of the function to register
+     * \param deinterleaver function to register
+     */
+    ConverterRegistry(const std::string &sourceFormat, const std::string &targetFormat, const FunctionPriority &priority, DeinterleaveFunction deinterleaver);
+
+    /*!
+     * Class constructor. Registers an InterleaveFunction with a
+     * given source format, target format, and priority.
+     *
+     * refuses to register the function and logs error if a source/target/priority entry already exists
+     * \param sourceFormat the format markup string of the planar inputs
+     * \param targetFormat the format markup string of the interleaved output
+     * \param priority the FunctionPriority of the function to register
+     * \param interleaver function to register
+     */
+    ConverterRegistry(const std::string &sourceFormat, const std::string &targetFormat, const FunctionPriority &priority, InterleaveFunction interleaver);
+
+    /*!
+     * Class constructor. Registers a CorrectionFunction with a
+     * given source format, target format, and priority.
+     *
+     * refuses to register the function and logs error if a source/target/priority entry already exists
+     * \param sourceFormat the source format markup string
+     * \param targetFormat the target format markup string
+     * \param priority the FunctionPriority of the function to register
+     * \param corrector function to register
+     */
+    ConverterRegistry(const std::string &sourceFormat, const std::string &targetFormat, const FunctionPriority &priority, CorrectionFunction corrector);
+
+    /*!
+     * Class constructor. Registers a StatisticsFunction with a
+     * given source format, target format, and priority.
+     *
+     * refuses to register the function and logs error if a source/target/priority entry already exists
+     * \param sourceFormat the source format markup string
+     * \param targetFormat the target format markup string
+     * \param priority the FunctionPriority of the function to register
+     * \param statistics function to register
+     */
+    ConverterRegistry(const std::string &sourceFormat, const std::string &targetFormat, const FunctionPriority &priority, StatisticsFunction statistics);
     
     /*!
      * Get a list of existing target formats to which we can convert the specified source from.
@@ -105,9 +257,19 @@ namespace SoapySDR
      * \return a vector of priorities or an empty vector if none found
      */
     static std::vector<FunctionPriority> listPriorities(const std::string &sourceFormat, const std::string &targetFormat);
+
+    /*!
+     * Get a list of available converter priorities for a given source and target format and variant.
+     * \param sourceFormat the source format markup string
+     * \param targetFormat the target format markup string
+     * \param variant the FunctionVariant of the converters
+     * \return a vector of priorities or an empty vector if none found
+     */
+    static std::vector<FunctionPriority> listPriorities(const std::string &sourceFormat, const std::string &targetFormat, const FunctionVariant &variant);
     
     /*!
      * Get a converter between a source and target format with the highest available priority.
+     * When autotune is enabled, the fastest converter measured on the host is returned instead.
      * \throws invalid_argument when the conversion does not exist and logs error
      * \param sourceFormat the source format markup string
      * \param targetFormat the target format markup string
@@ -115,17 +277,351 @@ namespace SoapySDR
      */
     static ConverterFunction getFunction(const std::string &sourceFormat, const std::string &targetFormat);
 
+    /*!
+     * Get a converter between a source and target format descriptor with the highest available priority.
+     * The converters are indexed by the interned format IDs,
+     * so the lookup does not compare or copy the format strings.
+     * \throws invalid_argument when the conversion does not exist and logs error
+     * \param sourceFormat the source format descriptor
+     * \param targetFormat the target format descriptor
+     * \return a conversion function pointer
+     */
+    static ConverterFunction getFunction(const FormatDescriptor &sourceFormat, const FormatDescriptor &targetFormat);
+
     /*!
      * Get a converter between a source and target format with a given priority.
      */
 
     static ConverterFunction getFunction(const std::string &sourceFormat, const std::string &targetFormat, const FunctionPriority &priority);
 
+    /*!
+     * Get a converter of a given variant with the highest available priority.
+     * \throws runtime_error when the conversion does not exist for the variant
+     * \param sourceFormat the source format markup string
+     * \param targetFormat the target format markup string
+     * \param variant the FunctionVariant of the converter
+     * \return a conversion function pointer
+     */
+    static ConverterFunction getFunction(const std::string &sourceFormat, const std::string &targetFormat, const FunctionVariant &variant);
+
+    /*!
+     * Get a converter of a given variant with a given priority.
+     * \throws runtime_error when the conversion does not exist for the variant
+     */
+    static ConverterFunction getFunction(const std::string &sourceFormat, const std::string &targetFormat, const FunctionPriority &priority, const FunctionVariant &variant);
+
     /*!
      * Get a list of known source formats in the registry.
      */
     static std::vector<std::string> listAvailableSourceFormats(void);
 
+    /*!
+     * Enable or disable autotuning of converter selection.
+     * When enabled, the first getFunction() call for a source and target format
+     * with multiple registered priorities times each priority on the host,
+     * and getFunction() returns the fastest one for the rest of the process.
+     * Autotuning is disabled by default, and it can also be enabled
+     * by setting the environment variable SOAPY_SDR_CONVERTER_AUTOTUNE=1.
+     * \param enable true to enable autotuning
+     */
+    static void setAutotune(const bool enable);
+
+    /*!
+     * Set a file which stores autotune results across processes.
+     * Results are keyed by the CPU model, so a file can be shared between hosts.
+     * The path can also be set with the environment variable SOAPY_SDR_CONVERTER_AUTOTUNE_CACHE.
+     * \param path the path of the cache file, or an empty string to disable the file
+     */
+    static void setAutotuneCache(const std::string &path);
+
+    /*!
+     * Get the cheapest chain of registered converters between a source and target format.
+     * A direct converter is always preferred. Otherwise, each hop is weighted by
+     * the bytes per element it moves, with a discount for VECTORIZED and CUSTOM
+     * converters, or by its measured time per element when autotune is enabled.
+     * Each converter is timed once, until a converter is registered for its formats.
+     * \param sourceFormat the source format markup string
+     * \param targetFormat the target format markup string
+     * \return the formats along the path from sourceFormat to targetFormat, or an empty vector if none found
+     */
+    static std::vector<std::string> getPath(const std::string &sourceFormat, const std::string &targetFormat);
+
+    /*!
+     * Can a buffer be converted in place between a source and target format?
+     * In place conversion is supported when the target element is not larger
+     * than the source element, and a converter or a path of converters exists.
+     * The input and output pointers must then be equal, partial overlap is not supported.
+     * \param sourceFormat the source format markup string
+     * \param targetFormat the target format markup string
+     * \return true when the input buffer can also be the output buffer
+     */
+    static bool supportsInPlace(const std::string &sourceFormat, const std::string &targetFormat);
+
+    /*!
+     * Get a list of available deinterleave priorities for a given source and target format.
+     * \param sourceFormat the format markup string of the interleaved input
+     * \param targetFormat the format markup string of the planar outputs
+     * \return a vector of priorities or an empty vector if none found
+     */
+    static std::vector<FunctionPriority> listDeinterleavePriorities(const std::string &sourceFormat, const std::string &targetFormat);
+
+    /*!
+     * Get a deinterleaver between a source and target format with the highest available priority.
+     * \throws runtime_error when the conversion does not exist
+     * \param sourceFormat the format markup string of the interleaved input
+     * \param targetFormat the format markup string of the planar outputs
+     * \return a deinterleave function pointer
+     */
+    static DeinterleaveFunction getDeinterleaveFunction(const std::string &sourceFormat, const std::string &targetFormat);
+
+    /*!
+     * Get a deinterleaver between a source and target format with a given priority.
+     * \throws runtime_error when the conversion does not exist
+     */
+    static DeinterleaveFunction getDeinterleaveFunction(const std::string &sourceFormat, const std::string &targetFormat, const FunctionPriority &priority);
+
+    /*!
+     * Get a list of available interleave priorities for a given source and target format.
+     * \param sourceFormat the format markup string of the planar inputs
+     * \param targetFormat the format markup string of the interleaved output
+     * \return a vector of priorities or an empty vector if none found
+     */
+    static std::vector<FunctionPriority> listInterleavePriorities(const std::string &sourceFormat, const std::string &targetFormat);
+
+    /*!
+     * Get an interleaver between a source and target format with the highest available priority.
+     * \throws runtime_error when the conversion does not exist
+     * \param sourceFormat the format markup string of the planar inputs
+     * \param targetFormat the format markup string of the interleaved output
+     * \return an interleave function pointer
+     */
+    static InterleaveFunction getInterleaveFunction(const std::string &sourceFormat, const std::string &targetFormat);
+
+    /*!
+     * Get an interleaver between a source and target format with a given priority.
+     * \throws runtime_error when the conversion does not exist
+     */
+    static InterleaveFunction getInterleaveFunction(const std::string &sourceFormat, const std::string &targetFormat, const FunctionPriority &priority);
+
+    /*!
+     * Get a list of available correction priorities for a given source and target format.
+     * \param sourceFormat the source format markup string
+     * \param targetFormat the target format markup string
+     * \return a vector of priorities or an empty vector if none found
+     */
+    static std::vector<FunctionPriority> listCorrectionPriorities(const std::string &sourceFormat, const std::string &targetFormat);
+
+    /*!
+     * Get a correction function between a source and target format with the highest available priority.
+     * \throws runtime_error when the conversion does not exist
+     * \param sourceFormat the source format markup string
+     * \param targetFormat the target format markup string
+     * \return a correction function pointer
+     */
+    static CorrectionFunction getCorrectionFunction(const std::string &sourceFormat, const std::string &targetFormat);
+
+    /*!
+     * Get a correction function between a source and target format with a given priority.
+     * \throws runtime_error when the conversion does not exist
+     */
+    static CorrectionFunction getCorrectionFunction(const std::string &sourceFormat, const std::string &targetFormat, const FunctionPriority &priority);
+
+    /*!
+     * Get a list of available statistics priorities for a given source and target format.
+     * \param sourceFormat the source format markup string
+     * \param targetFormat the target format markup string
+     * \return a vector of priorities or an empty vector if none found
+     */
+    static std::vector<FunctionPriority> listStatisticsPriorities(const std::string &sourceFormat, const std::string &targetFormat);
+
+    /*!
+     * Get a statistics function between a source and target format with the highest available priority.
+     * \throws runtime_error when the conversion does not exist
+     * \param sourceFormat the source format markup string
+     * \param targetFormat the target format markup string
+     * \return a statistics function pointer
+     */
+    static StatisticsFunction getStatisticsFunction(const std::string &sourceFormat, const std::string &targetFormat);
+
+    /*!
+     * Get a statistics function between a source and target format with a given priority.
+     * \throws runtime_error when the conversion does not exist
+     */
+    static StatisticsFunction getStatisticsFunction(const std::string &sourceFormat, const std::string &targetFormat, const FunctionPriority &priority);
+
+    /*!
+     * A Handle binds a converter function to its source format, target format, and scaler.
+     * The registry lookup happens once when the handle is created,
+     * so that convert() can be called per packet without any string comparisons.
+     */
+    class SOAPY_SDR_API Handle
+    {
+    public:
+      //! Create an empty handle, convert() must not be called until assigned
+      Handle(void);
+
+      /*!
+       * Create a handle to the converter with the highest available priority.
+       * When there is no direct converter, the handle chains the converters
+       * along the cheapest path from getPath(), and converts through
+       * internal scratch buffers one cache-sized block at a time.
+       * \throws runtime_error when the conversion does not exist
+       * \param sourceFormat the source format markup string
+       * \param targetFormat the target format markup string
+       * \param scaler the scaler passed to the converter on each call
+       */
+      Handle(const std::string &sourceFormat, const std::string &targetFormat, const double scaler = 1.0);
+
+      /*!
+       * Create a handle to the converter with a given priority.
+       * \throws runtime_error when the conversion does not exist
+       * \param sourceFormat the source format markup string
+       * \param targetFormat the target format markup string
+       * \param priority the FunctionPriority of the converter
+       * \param scaler the scaler passed to the converter on each call
+       */
+      Handle(const std::string &sourceFormat, const std::string &targetFormat, const FunctionPriority &priority, const double scaler = 1.0);
+
+      /*!
+       * Create a handle to the converter of a given variant with the highest available priority.
+       * \throws runtime_error when the conversion does not exist for the variant
+       * \param sourceFormat the source format markup string
+       * \param targetFormat the target format markup string
+       * \param variant the FunctionVariant of the converter
+       * \param scaler the scaler passed to the converter on each call
+       */
+      Handle(const std::string &sourceFormat, const std::string &targetFormat, const FunctionVariant &variant, const double scaler = 1.0);
+
+      /*!
+       * Create a handle to the correction function with the highest available priority.
+       * The handle applies the correction while converting,
+       * and the correction can be changed between calls to convert().
+       * \throws runtime_error when the conversion does not exist
+       * \param sourceFormat the source format markup string
+       * \param targetFormat the target format markup string
+       * \param correction the initial correction parameters
+       * \param scaler the scaler passed to the converter on each call
+       */
+      Handle(const std::string &sourceFormat, const std::string &targetFormat, const Correction &correction, const double scaler = 1.0);
+
+      //! Get the source format markup string
+      const std::string &getSourceFormat(void) const;
+
+      //! Get the target format markup string
+      const std::string &getTargetFormat(void) const;
+
+      //! Get the size in bytes of a source element
+      size_t getSourceSize(void) const;
+
+      //! Get the size in bytes of a target element
+      size_t getTargetSize(void) const;
+
+      //! Get the bound converter function, or nullptr for a multi-hop path or a correction
+      ConverterFunction getFunction(void) const;
+
+      //! Change the scaler for subsequent calls to convert()
+      void setScaler(const double scaler);
+
+      //! Get the scaler passed to the converter
+      double getScaler(void) const;
+
+      //! Change the correction for subsequent calls to convert(), only for handles made with a correction
+      void setCorrection(const Correction &correction);
+
+      //! Get the correction passed to the correction function
+      const Correction &getCorrection(void) const;
+
+      /*!
+       * Write large outputs with the STREAMING variant of the converter.
+       * Its non-temporal stores keep output which is not read again soon,
+       * such as a capture written to disk, from evicting the next input from the cache.
+       * Conversions with less output than the threshold use the bound converter.
+       * Handles to a multi-hop path or a correction, and hosts without
+       * a streaming converter for the formats, always use the bound converter.
+       * \param thresholdBytes the output size in bytes, or 0 to disable streaming
+       */
+      void setStreamingThreshold(const size_t thresholdBytes);
+
+      //! Get the output size in bytes at which the streaming converter is used, or 0 when disabled
+      size_t getStreamingThreshold(void) const;
+
+      //! Would a conversion of numElems elements use the streaming converter?
+      bool isStreaming(const size_t numElems) const
+      {
+        return _streamer != nullptr and numElems >= _streamingElems;
+      }
+
+      /*!
+       * Convert a buffer with the bound function and scaler.
+       * \param srcBuff the input buffer in the source format
+       * \param dstBuff the output buffer in the target format
+       * \param numElems the number of elements to convert
+       */
+      void convert(const void *srcBuff, void *dstBuff, const size_t numElems) const
+      {
+        if (_corrector != nullptr) _corrector(srcBuff, dstBuff, numElems, _scaler, _correction);
+        else if (this->isStreaming(numElems)) _streamer(srcBuff, dstBuff, numElems, _scaler);
+        else if (_hops.empty()) _function(srcBuff, dstBuff, numElems, _scaler);
+        else this->convertPath(srcBuff, dstBuff, numElems);
+      }
+
+    private:
+      void convertPath(const void *srcBuff, void *dstBuff, const size_t numElems) const;
+
+      //! One converter of a multi-hop path
+      struct Hop
+      {
+        ConverterFunction function;
+        size_t targetSize;
+      };
+
+      ConverterFunction _function;
+      ConverterFunction _streamer;
+      CorrectionFunction _corrector;
+      Correction _correction;
+      std::vector<Hop> _hops;
+      size_t _scaledHop;
+      double _scaler;
+      size_t _streamingThreshold;
+      size_t _streamingElems;
+      std::string _sourceFormat;
+      std::string _targetFormat;
+      size_t _sourceSize;
+      size_t _targetSize;
+    };
+
+    /*!
+     * An Executor runs every task in the list and returns once all of them have completed.
+     * The tasks are independent and may be run concurrently in any order.
+     * An application can supply an executor to run conversions on its own thread pool.
+     */
+    typedef std::function<void(const std::vector<std::function<void(void)>> &)> Executor;
+
+    /*!
+     * Convert a large buffer across multiple threads.
+     * The buffer is split into cache-sized chunks, and each chunk is
+     * converted by the handle's function with the handle's scaler.
+     * Small buffers and in place conversions to a smaller format are converted in the calling thread.
+     * The worker threads are kept in a pool which persists between calls.
+     * \param handle a handle to the converter and its scaler
+     * \param srcBuff the input buffer in the source format
+     * \param dstBuff the output buffer in the target format
+     * \param numElems the number of elements to convert
+     * \param numThreads the number of worker threads, or 0 for the hardware concurrency
+     */
+    static void convertParallel(const Handle &handle, const void *srcBuff, void *dstBuff, const size_t numElems, const size_t numThreads = 0);
+
+    /*!
+     * Convert a large buffer with a user-supplied executor.
+     * The buffer is split into cache-sized chunks, and each chunk is one task for the executor.
+     * \param handle a handle to the converter and its scaler
+     * \param srcBuff the input buffer in the source format
+     * \param dstBuff the output buffer in the target format
+     * \param numElems the number of elements to convert
+     * \param executor runs the chunk tasks and returns when they are done
+     */
+    static void convertParallel(const Handle &handle, const void *srcBuff, void *dstBuff, const size_t numElems, const Executor &executor);
+
   };
   
 }
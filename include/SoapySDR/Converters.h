@@ -22,6 +22,22 @@
  */
 typedef void (*SoapySDRConverterFunction)(const void *, void *, const size_t, const double);
 
+/*!
+ * A typedef for declaring a DeinterleaveFunction to be maintained in the ConverterRegistry.
+ * A deinterleave function converts a buffer of channel-interleaved elements
+ * of one format into one planar output buffer per channel of another format.
+ * The parameters are (input pointer, output pointers, number of channels, number of elements, optional scalar)
+ */
+typedef void (*SoapySDRConverterDeinterleaveFunction)(const void *, void * const *, const size_t, const size_t, const double);
+
+/*!
+ * A typedef for declaring an InterleaveFunction to be maintained in the ConverterRegistry.
+ * An interleave function converts one planar input buffer per channel of one format
+ * into a buffer of channel-interleaved elements of another format.
+ * The parameters are (input pointers, output pointer, number of channels, number of elements, optional scalar)
+ */
+typedef void (*SoapySDRConverterInterleaveFunction)(const void * const *, void *, const size_t, const size_t, const double);
+
 /*!
  * Allow selection of a converter function with a given source and target format.
  */
@@ -37,6 +53,38 @@ typedef enum
     SOAPY_SDR_CONVERTER_CUSTOM = 5
 } SoapySDRConverterFunctionPriority;
 
+/*!
+ * Select the overflow or memory behavior of a converter function.
+ */
+typedef enum
+{
+    //! Float to integer conversions truncate toward zero and clamp to the integer range.
+    //! The default; the name is historical, no variant wraps on overflow.
+    SOAPY_SDR_CONVERTER_WRAPPING = 0,
+
+    //! Float to integer conversions round to nearest and clamp to the integer range.
+    SOAPY_SDR_CONVERTER_SATURATING = 1,
+
+    //! Like the default, but the output is written with non-temporal stores which bypass the cache.
+    SOAPY_SDR_CONVERTER_STREAMING = 2
+} SoapySDRConverterFunctionVariant;
+
+/*!
+ * Correction parameters for converters which also correct the front end.
+ * The complex output sample is matrix * (scaler * x - dcOffset).
+ */
+typedef struct
+{
+    //! The DC offset removed from the scaled sample, as I and Q
+    double dcOffset[2];
+
+    //! The IQ correction matrix, row major
+    double matrix[2][2];
+} SoapySDRConverterCorrection;
+
+//! Forward declaration of converter handle
+typedef struct SoapySDRConverterHandle SoapySDRConverterHandle;
+
 #ifdef __cplusplus
 extern "C"
 {
@@ -83,6 +131,15 @@ SOAPY_SDR_API SoapySDRConverterFunction SoapySDRConverter_getFunction(const char
  */
 SOAPY_SDR_API SoapySDRConverterFunction SoapySDRConverter_getFunctionWithPriority(const char *sourceFormat, const char *targetFormat, const SoapySDRConverterFunctionPriority priority);
 
+/*!
+ * Get a converter of a given variant with the highest available priority.
+ * \param sourceFormat the source format markup string
+ * \param targetFormat the target format markup string
+ * \param variant the variant of the converter
+ * \return a conversion function pointer or nullptr if none are found
+ */
+SOAPY_SDR_API SoapySDRConverterFunction SoapySDRConverter_getFunctionWithVariant(const char *sourceFormat, const char *targetFormat, const SoapySDRConverterFunctionVariant variant);
+
 /*!
  * Get a list of known source formats in the registry.
  * \param [out] length the number of known source formats
@@ -90,6 +147,113 @@ SOAPY_SDR_API SoapySDRConverterFunction SoapySDRConverter_getFunctionWithPriorit
  */
 SOAPY_SDR_API char **SoapySDRConverter_listAvailableSourceFormats(size_t *length);
 
+/*!
+ * Get a deinterleaver between a source and target format with the highest available priority.
+ * \param sourceFormat the format markup string of the interleaved input
+ * \param targetFormat the format markup string of the planar outputs
+ * \return a deinterleave function pointer or nullptr if none are found
+ */
+SOAPY_SDR_API SoapySDRConverterDeinterleaveFunction SoapySDRConverter_getDeinterleaveFunction(const char *sourceFormat, const char *targetFormat);
+
+/*!
+ * Get an interleaver between a source and target format with the highest available priority.
+ * \param sourceFormat the format markup string of the planar inputs
+ * \param targetFormat the format markup string of the interleaved output
+ * \return an interleave function pointer or nullptr if none are found
+ */
+SOAPY_SDR_API SoapySDRConverterInterleaveFunction SoapySDRConverter_getInterleaveFunction(const char *sourceFormat, const char *targetFormat);
+
+/*!
+ * Make a handle which binds the highest priority converter to its formats and scaler.
+ * The registry lookup happens once, so that SoapySDRConverter_convert()
+ * can be called per packet without any string comparisons.
+ * \param sourceFormat the source format markup string
+ * \param targetFormat the target format markup string
+ * \param scaler the scaler passed to the converter on each call
+ * \return a converter handle or nullptr if the conversion is not found
+ */
+SOAPY_SDR_API SoapySDRConverterHandle *SoapySDRConverter_makeHandle(const char *sourceFormat, const char *targetFormat, const double scaler);
+
+/*!
+ * Make a handle which binds a converter with a given priority to its formats and scaler.
+ * \param sourceFormat the source format markup string
+ * \param targetFormat the target format markup string
+ * \param priority the priority of the converter
+ * \param scaler the scaler passed to the converter on each call
+ * \return a converter handle or nullptr if the conversion is not found
+ */
+SOAPY_SDR_API SoapySDRConverterHandle *SoapySDRConverter_makeHandleWithPriority(const char *sourceFormat, const char *targetFormat, const SoapySDRConverterFunctionPriority priority, const double scaler);
+
+/*!
+ * Make a handle which binds the highest priority converter of a given variant to its formats and scaler.
+ * \param sourceFormat the source format markup string
+ * \param targetFormat the target format markup string
+ * \param variant the variant of the converter
+ * \param scaler the scaler passed to the converter on each call
+ * \return a converter handle or nullptr if the conversion is not found
+ */
+SOAPY_SDR_API SoapySDRConverterHandle *SoapySDRConverter_makeHandleWithVariant(const char *sourceFormat, const char *targetFormat, const SoapySDRConverterFunctionVariant variant, const double scaler);
+
+/*!
+ * Make a handle which applies a DC offset and IQ correction while converting.
+ * \param sourceFormat the source format markup string
+ * \param targetFormat the target format markup string
+ * \param correction the initial correction parameters, or NULL for the identity correction
+ * \param scaler the scaler passed to the converter on each call
+ * \return a converter handle or nullptr if the conversion is not found
+ */
+SOAPY_SDR_API SoapySDRConverterHandle *SoapySDRConverter_makeHandleWithCorrection(const char *sourceFormat, const char *targetFormat, const SoapySDRConverterCorrection *correction, const double scaler);
+
+/*!
+ * Free a converter handle made by SoapySDRConverter_makeHandle().
+ * \param handle a pointer to a converter handle
+ */
+SOAPY_SDR_API void SoapySDRConverter_freeHandle(SoapySDRConverterHandle *handle);
+
+/*!
+ * Change the scaler passed to the converter by subsequent conversions.
+ * \param handle a pointer to a converter handle
+ * \param scaler the new scaler
+ */
+SOAPY_SDR_API void SoapySDRConverter_setScaler(SoapySDRConverterHandle *handle, const double scaler);
+
+/*!
+ * Change the correction applied by subsequent conversions.
+ * \param handle a pointer to a converter handle made with a correction
+ * \param correction the new correction parameters, or NULL for the identity correction
+ */
+SOAPY_SDR_API void SoapySDRConverter_setCorrection(SoapySDRConverterHandle *handle, const SoapySDRConverterCorrection *correction);
+
+/*!
+ * Write large outputs with the streaming variant of the converter.
+ * Conversions with less output than the threshold use the bound converter.
+ * \param handle a pointer to a converter handle
+ * \param thresholdBytes the output size in bytes, or 0 to disable streaming
+ * \return 0 for success or error code on failure
+ */
+SOAPY_SDR_API int SoapySDRConverter_setStreamingThreshold(SoapySDRConverterHandle *handle, const size_t thresholdBytes);
+
+/*!
+ * Convert a buffer with the function and scaler bound to the handle.
+ * \param handle a pointer to a converter handle
+ * \param srcBuff the input buffer in the source format
+ * \param dstBuff the output buffer in the target format
+ * \param numElems the number of elements to convert
+ */
+SOAPY_SDR_API void SoapySDRConverter_convert(const SoapySDRConverterHandle *handle, const void *srcBuff, void *dstBuff, const size_t numElems);
+
+/*!
+ * Convert a large buffer across multiple threads.
+ * The buffer is split into cache-sized chunks which are converted by a pool of worker threads.
+ * \param handle a pointer to a converter handle
+ * \param srcBuff the input buffer in the source format
+ * \param dstBuff the output buffer in the target format
+ * \param numElems the number of elements to convert
+ * \param numThreads the number of worker threads, or 0 for the hardware concurrency
+ * \return 0 for success or error code on failure
+ */
+SOAPY_SDR_API int SoapySDRConverter_convertParallel(const SoapySDRConverterHandle *handle, const void *srcBuff, void *dstBuff, const size_t numElems, const size_t numThreads);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,128 @@
+///
+/// \file SoapySDR/ConvertingStream.hpp
+///
+/// Stream in any convertible format on top of the native stream format.
+///
+/// \copyright
+/// Copyright (c) 2021-2021 Josh Blum
+/// SPDX-License-Identifier: BSL-1.0
+///
+
+#pragma once
+#include <SoapySDR/Config.hpp>
+#include <SoapySDR/Device.hpp>
+#include <SoapySDR/ConverterRegistry.hpp>
+#include <vector>
+#include <string>
+#include <cstddef> //size_t
+
+namespace SoapySDR
+{
+
+/*!
+ * A ConvertingStream streams any format that the ConverterRegistry
+ * can convert to or from the native stream format of a device,
+ * so that every driver supports the formats which have fast converters.
+ *
+ * When the requested format is not the native format, the native stream
+ * is opened on the device, and readStream() and writeStream() convert
+ * through a converter handle bound at construction and a scratch buffer
+ * of one MTU per channel, so the calls do not allocate.
+ * The values are scaled so that the native full scale from
+ * Device::getNativeStreamFormat() maps to the full scale of the
+ * requested format. The native full scale is rounded up to a power of two,
+ * so the scaling is exact and the largest native value does not overflow.
+ * When the requested format is the native format, the calls pass through.
+ *
+ * The stream has no internal locking, like the stream it wraps.
+ */
+class SOAPY_SDR_API ConvertingStream
+{
+public:
+
+    /*!
+     * Setup the native stream on the device.
+     * See Device::setupStream() for the parameters.
+     * \throws runtime_error when there is no converter between the formats
+     * \param device the device which owns the stream
+     * \param direction the channel direction (`SOAPY_SDR_RX` or `SOAPY_SDR_TX`)
+     * \param format the format of the buffers in readStream() and writeStream()
+     * \param channels a list of channels or empty for automatic
+     * \param args stream args or empty for defaults
+     */
+    ConvertingStream(
+        Device *device,
+        const int direction,
+        const std::string &format,
+        const std::vector<size_t> &channels = std::vector<size_t>(),
+        const Kwargs &args = Kwargs());
+
+    //! Close the native stream
+    ~ConvertingStream(void);
+
+    //! Get the native stream, for the calls that are not wrapped
+    Stream *getNativeStream(void) const;
+
+    //! Get the format of the buffers in readStream() and writeStream()
+    const std::string &getFormat(void) const;
+
+    //! Get the native stream format of the device
+    const std::string &getNativeFormat(void) const;
+
+    //! Are the buffers converted, or is the requested format the native format?
+    bool isConverting(void) const;
+
+    //! Get the MTU of the native stream in number of elements
+    size_t getStreamMTU(void) const;
+
+    //! Activate the native stream, see Device::activateStream()
+    int activateStream(const int flags = 0, const long long timeNs = 0, const size_t numElems = 0);
+
+    //! Deactivate the native stream, see Device::deactivateStream()
+    int deactivateStream(const int flags = 0, const long long timeNs = 0);
+
+    /*!
+     * Read and convert elements from a receive stream.
+     * At most one MTU of elements is read per call when converting.
+     * See Device::readStream() for the parameters.
+     * \return the number of elements read per buffer or error code
+     */
+    int readStream(
+        void * const *buffs,
+        const size_t numElems,
+        int &flags,
+        long long &timeNs,
+        const long timeoutUs = 100000);
+
+    /*!
+     * Convert and write elements to a transmit stream.
+     * At most one MTU of elements is written per call when converting.
+     * See Device::writeStream() for the parameters.
+     * \return the number of elements written per buffer or error code
+     */
+    int writeStream(
+        const void * const *buffs,
+        const size_t numElems,
+        int &flags,
+        const long long timeNs = 0,
+        const long timeoutUs = 100000);
+
+    //! Readback status information about the native stream, see Device::readStreamStatus()
+    int readStreamStatus(size_t &chanMask, int &flags, long long &timeNs, const long timeoutUs = 100000);
+
+private:
+    //non-copyable, the native stream is closed once
+    ConvertingStream(const ConvertingStream &) = delete;
+    ConvertingStream &operator=(const ConvertingStream &) = delete;
+
+    Device *_device;
+    const std::string _format;
+    std::string _nativeFormat;
+    Stream *_stream;
+    size_t _mtu;
+    ConverterRegistry::Handle _converter;
+    std::vector<char> _scratch;
+    std::vector<void *> _scratchBuffs;
+};
+
+}
@@ -458,6 +458,53 @@ SOAPY_SDR_API int SoapySDRDevice_readStreamStatus(SoapySDRDevice *device,
     long long *timeNs,
     const long timeoutUs);
 
+/*******************************************************************
+ * Async stream API
+ ******************************************************************/
+
+/*!
+ * Typedef for the callback of an async receive stream.
+ * The arguments match the results of SoapySDRDevice_readStream():
+ * each buffer holds ret elements when ret is not negative,
+ * otherwise ret is an error code such as SOAPY_SDR_OVERFLOW,
+ * and buffs is NULL. The buffers are only valid until the callback returns.
+ * After an error other than an overflow, a corruption, or a time error,
+ * the callback is not called again until the async stream is restarted.
+ */
+typedef void (*SoapySDRAsyncStreamCallback)(const void * const *buffs, const int ret, const int flags, const long long timeNs, void *userData);
+
+/*!
+ * Start delivering the buffers of a receive stream to a callback.
+ * The callback is called on an I/O thread which is managed by the
+ * library or the driver, until SoapySDRDevice_stopAsyncStream() is called.
+ * The stream is activated and deactivated as usual.
+ *
+ * \param device a pointer to a device instance
+ * \param stream the opaque pointer to a stream handle
+ * \param callback the callback for each buffer or error
+ * \param userData the last argument of each callback
+ * \param format the format which the stream was setup with
+ * \param numChans the number of channels in the stream
+ * \param numBuffs the number of buffers between the stream and the callback
+ * \return 0 for success or error code, such as when already started
+ */
+SOAPY_SDR_API int SoapySDRDevice_startAsyncStream(SoapySDRDevice *device,
+    SoapySDRStream *stream,
+    SoapySDRAsyncStreamCallback callback,
+    void *userData,
+    const char *format,
+    const size_t numChans,
+    const size_t numBuffs);
+
+/*!
+ * Stop the callbacks of an async receive stream.
+ * When this call returns, the callback is not running and is not called again.
+ * \param device a pointer to a device instance
+ * \param stream the opaque pointer to a stream handle
+ * \return 0 for success or error code, such as when not started
+ */
+SOAPY_SDR_API int SoapySDRDevice_stopAsyncStream(SoapySDRDevice *device, SoapySDRStream *stream);
+
 /*******************************************************************
  * Direct buffer access API
  ******************************************************************/
@@ -18,6 +18,7 @@
 #include <vector>
 #include <string>
 #include <complex>
+#include <functional>
 #include <cstddef> //size_t
 
 namespace SoapySDR
@@ -26,6 +27,17 @@ namespace SoapySDR
 //! Forward declaration of stream handle for type safety
 class Stream;
 
+/*!
+ * Typedef for the callback of an async receive stream.
+ * The arguments match the results of Device::readStream():
+ * each buffer holds ret elements when ret is not negative,
+ * otherwise ret is an error code such as SOAPY_SDR_OVERFLOW,
+ * and buffs is null. The buffers are only valid until the callback returns.
+ * After an error other than an overflow, a corruption, or a time error,
+ * the callback is not called again until the async stream is restarted.
+ */
+typedef std::function<void(const void * const *buffs, const int ret, const int flags, const long long timeNs)> AsyncStreamCallback;
+
 /*!
  * Abstraction for an SDR transceiver device - configuration and streaming.
  */
@@ -411,6 +423,47 @@ public:
         long long &timeNs,
         const long timeoutUs = 100000);
 
+    /*******************************************************************
+     * Async stream API
+     ******************************************************************/
+
+    /*!
+     * Start delivering the buffers of a receive stream to a callback.
+     * The callback is called on an I/O thread which is managed by the
+     * library or the driver, until stopAsyncStream() is called,
+     * so that the client does not poll readStream() from its own thread.
+     * The stream is activated and deactivated as usual.
+     *
+     * The default implementation reads the stream into a DirectAccessRing
+     * of numBuffs buffers, or acquires the driver's direct access buffers,
+     * and calls the callback from its own thread, so that a slow callback
+     * causes overflows rather than stalling the reads.
+     * Drivers which can post completions directly override both calls.
+     *
+     * \param stream the opaque pointer to a stream handle
+     * \param callback the callback for each buffer or error
+     * \param format the format which the stream was setup with
+     * \param numChans the number of channels in the stream
+     * \param numBuffs the number of buffers between the stream and the callback
+     * \return 0 for success or error code, such as when already started
+     */
+    virtual int startAsyncStream(
+        Stream *stream,
+        const AsyncStreamCallback &callback,
+        const std::string &format,
+        const size_t numChans,
+        const size_t numBuffs = 16);
+
+    /*!
+     * Stop the callbacks of an async receive stream.
+     * When this call returns, the callback is not running and is not called again.
+     * Stop the async stream before the stream is closed,
+     * and do not call stopAsyncStream() from the callback.
+     * \param stream the opaque pointer to a stream handle
+     * \return 0 for success or error code, such as when not started
+     */
+    virtual int stopAsyncStream(Stream *stream);
+
     /*******************************************************************
      * Direct buffer access API
      ******************************************************************/
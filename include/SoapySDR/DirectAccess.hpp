@@ -0,0 +1,275 @@
+///
+/// \file SoapySDR/DirectAccess.hpp
+///
+/// Stream API implementations on top of the direct buffer access API.
+///
+/// \copyright
+/// Copyright (c) 2021-2021 Josh Blum
+/// SPDX-License-Identifier: BSL-1.0
+///
+
+#pragma once
+#include <SoapySDR/Config.hpp>
+#include <SoapySDR/Device.hpp>
+#include <SoapySDR/ConverterRegistry.hpp>
+#include <vector>
+#include <string>
+#include <cstddef> //size_t
+
+namespace SoapySDR
+{
+
+/*!
+ * A DirectAccessReader implements Device::readStream() for a driver
+ * with acquireReadBuffer() and releaseReadBuffer().
+ *
+ * The driver opts in by keeping one reader per receive stream
+ * and calling the reader's readStream() from its own readStream().
+ * Each element is copied once, from the acquired buffer into the
+ * caller's buffer, and converted in the same pass when the stream
+ * format is not the native format of the buffers.
+ *
+ * A buffer larger than the read is held and returned in fragments:
+ * all but the last fragment have the SOAPY_SDR_MORE_FRAGMENTS flag,
+ * and only the last fragment keeps SOAPY_SDR_END_BURST.
+ */
+class SOAPY_SDR_API DirectAccessReader
+{
+public:
+
+    /*!
+     * Create a reader for a receive stream.
+     * \throws runtime_error when there is no converter between the formats
+     * \param device the device which implements the direct buffer access API
+     * \param stream the receive stream of the device
+     * \param numChans the number of channels in the stream
+     * \param nativeFormat the format of the acquired buffers
+     * \param format the format of the buffers in readStream()
+     * \param scaler the scaler passed to the converter
+     */
+    DirectAccessReader(
+        Device *device,
+        Stream *stream,
+        const size_t numChans,
+        const std::string &nativeFormat,
+        const std::string &format,
+        const double scaler = 1.0);
+
+    //! Release the held buffer, destroy the reader before the stream is closed
+    ~DirectAccessReader(void);
+
+    /*!
+     * Set the sample rate to timestamp the fragments after the first.
+     * Without a rate, only the first fragment of a buffer has a timestamp.
+     * \param rate the sample rate of the stream in samples per second
+     */
+    void setSampleRate(const double rate);
+
+    /*!
+     * Read elements from the held buffer or from a newly acquired buffer.
+     * See Device::readStream() for the parameters.
+     * \return the number of elements read per buffer or error code
+     */
+    int readStream(
+        void * const *buffs,
+        const size_t numElems,
+        int &flags,
+        long long &timeNs,
+        const long timeoutUs = 100000);
+
+    //! Release the held buffer, such as when the stream is deactivated
+    void reset(void);
+
+private:
+    DirectAccessReader(const DirectAccessReader &) = delete;
+    DirectAccessReader &operator=(const DirectAccessReader &) = delete;
+
+    Device *_device;
+    Stream *_stream;
+    const bool _converting;
+    ConverterRegistry::Handle _converter;
+    size_t _elemSize;
+    double _rate;
+
+    //the held buffer, which has the elements from _offset to _numElems left to read
+    bool _held;
+    size_t _handle;
+    std::vector<const void *> _buffs;
+    size_t _offset;
+    size_t _numElems;
+    int _flags;
+    long long _timeNs;
+};
+
+/*!
+ * A DirectAccessWriter implements Device::writeStream() for a driver
+ * with acquireWriteBuffer() and releaseWriteBuffer().
+ *
+ * The driver opts in by keeping one writer per transmit stream
+ * and calling the writer's writeStream() from its own writeStream().
+ * Each call acquires one buffer, which is filled in a single pass
+ * and converted when the stream format is not the native format,
+ * and released right away, so the elements are not delayed.
+ * A write larger than the buffer keeps SOAPY_SDR_END_BURST
+ * for the call that writes the last element.
+ */
+class SOAPY_SDR_API DirectAccessWriter
+{
+public:
+
+    /*!
+     * Create a writer for a transmit stream.
+     * \throws runtime_error when there is no converter between the formats
+     * \param device the device which implements the direct buffer access API
+     * \param stream the transmit stream of the device
+     * \param numChans the number of channels in the stream
+     * \param nativeFormat the format of the acquired buffers
+     * \param format the format of the buffers in writeStream()
+     * \param scaler the scaler passed to the converter
+     */
+    DirectAccessWriter(
+        Device *device,
+        Stream *stream,
+        const size_t numChans,
+        const std::string &nativeFormat,
+        const std::string &format,
+        const double scaler = 1.0);
+
+    /*!
+     * Write elements into a newly acquired buffer.
+     * See Device::writeStream() for the parameters.
+     * \return the number of elements written per buffer or error code
+     */
+    int writeStream(
+        const void * const *buffs,
+        const size_t numElems,
+        int &flags,
+        const long long timeNs = 0,
+        const long timeoutUs = 100000);
+
+private:
+    DirectAccessWriter(const DirectAccessWriter &) = delete;
+    DirectAccessWriter &operator=(const DirectAccessWriter &) = delete;
+
+    Device *_device;
+    Stream *_stream;
+    const bool _converting;
+    ConverterRegistry::Handle _converter;
+    size_t _elemSize;
+    std::vector<void *> _buffs;
+};
+
+/*!
+ * A DirectAccessRing provides the direct buffer access API on any stream,
+ * so that zero-copy consumers have one code path for every driver.
+ *
+ * When the driver implements direct buffer access, the calls pass through
+ * to the device, and the buffers are the driver's DMA buffers.
+ * Otherwise the ring preallocates a pool of aligned buffers, and a
+ * background thread fills them with readStream() for a receive stream,
+ * or drains them with writeStream() for a transmit stream.
+ * The handles index the pool, as they index the driver's buffers.
+ *
+ * Stream errors from the thread, such as overflows, are returned
+ * in order by acquireReadBuffer(), or by the next acquireWriteBuffer().
+ * A receive error other than an overflow, a corruption, or a time error,
+ * such as SOAPY_SDR_STREAM_ERROR, stops the thread, and acquireReadBuffer()
+ * returns it after the buffers before it, until the ring is started again.
+ * The calls are for one consumer thread, as with the device API.
+ */
+class SOAPY_SDR_API DirectAccessRing
+{
+public:
+
+    /*!
+     * Create a ring for a stream of the device, which the ring does not own.
+     * \param device the device which owns the stream
+     * \param stream the stream from Device::setupStream()
+     * \param direction the channel direction (`SOAPY_SDR_RX` or `SOAPY_SDR_TX`)
+     * \param numChans the number of channels in the stream
+     * \param format the format of the stream
+     * \param numBuffs the number of buffers in the pool
+     * \param buffSize the elements per buffer or 0 for the stream MTU
+     */
+    DirectAccessRing(
+        Device *device,
+        Stream *stream,
+        const int direction,
+        const size_t numChans,
+        const std::string &format,
+        const size_t numBuffs = 16,
+        const size_t buffSize = 0);
+
+    //! Stop the thread, destroy the ring before the stream is closed
+    ~DirectAccessRing(void);
+
+    //! Does the ring emulate the buffers, or does the driver implement direct access?
+    bool isEmulated(void) const;
+
+    /*!
+     * Activate the stream and start the thread, see Device::activateStream().
+     * Any buffers which were read but not acquired before are dropped.
+     */
+    int activateStream(const int flags = 0, const long long timeNs = 0, const size_t numElems = 0);
+
+    /*!
+     * Stop the thread and deactivate the stream, see Device::deactivateStream().
+     * The buffers which were released to a transmit stream are written first.
+     */
+    int deactivateStream(const int flags = 0, const long long timeNs = 0);
+
+    /*!
+     * Start the thread, for a stream which is activated separately.
+     * Any buffers which were read but not acquired before are dropped.
+     */
+    void start(void);
+
+    /*!
+     * Stop the thread, for a stream which is deactivated separately.
+     * The buffers which were released to a transmit stream are written first.
+     */
+    void stop(void);
+
+    //! How many direct access buffers, see Device::getNumDirectAccessBuffers()
+    size_t getNumDirectAccessBuffers(void);
+
+    //! Get the buffer addresses of a handle, see Device::getDirectAccessBufferAddrs()
+    int getDirectAccessBufferAddrs(const size_t handle, void **buffs);
+
+    //! Acquire a filled receive buffer, see Device::acquireReadBuffer()
+    int acquireReadBuffer(
+        size_t &handle,
+        const void **buffs,
+        int &flags,
+        long long &timeNs,
+        const long timeoutUs = 100000);
+
+    //! Release a receive buffer to be filled again, see Device::releaseReadBuffer()
+    void releaseReadBuffer(const size_t handle);
+
+    //! Acquire an empty transmit buffer, see Device::acquireWriteBuffer()
+    int acquireWriteBuffer(
+        size_t &handle,
+        void **buffs,
+        const long timeoutUs = 100000);
+
+    //! Release a filled transmit buffer to be written, see Device::releaseWriteBuffer()
+    void releaseWriteBuffer(
+        const size_t handle,
+        const size_t numElems,
+        int &flags,
+        const long long timeNs = 0);
+
+private:
+    DirectAccessRing(const DirectAccessRing &) = delete;
+    DirectAccessRing &operator=(const DirectAccessRing &) = delete;
+
+    Device *_device;
+    Stream *_stream;
+
+    //the pool and the thread, null when the driver implements direct access
+    struct Impl;
+    Impl *_impl;
+};
+
+}
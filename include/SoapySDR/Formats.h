@@ -72,6 +72,59 @@
 //! Real unsigned 8-bit integers (uint8)
 #define SOAPY_SDR_U8 "U8"
 
+/*!
+ * Byte order suffix for big endian formats.
+ * The formats above are in host byte order, and a format string
+ * with this suffix holds the same samples in big endian byte order,
+ * as carried by network protocols and some capture files.
+ */
+#define SOAPY_SDR_BIG_ENDIAN "BE"
+
+//! Complex signed 32-bit integers in big endian byte order
+#define SOAPY_SDR_CS32BE "CS32BE"
+
+//! Complex signed 16-bit integers in big endian byte order
+#define SOAPY_SDR_CS16BE "CS16BE"
+
+//! Real signed 32-bit integers in big endian byte order
+#define SOAPY_SDR_S32BE "S32BE"
+
+//! Real signed 16-bit integers in big endian byte order
+#define SOAPY_SDR_S16BE "S16BE"
+
+/*!
+ * A compact descriptor of a format string.
+ * Formats are interned: the attributes are parsed once,
+ * and equal format strings have the same ID for the life of the process,
+ * so per-packet code can keep the descriptor instead of the string.
+ */
+typedef struct
+{
+    //! The interned ID, or 0 for an empty format
+    unsigned id;
+
+    //! The interned format string, valid for the life of the process
+    const char *format;
+
+    //! The size of a single element in bytes
+    size_t size;
+
+    //! The number of bits in each value (in each of I and Q for complex formats)
+    size_t bitDepth;
+
+    //! True for complex formats
+    bool isComplex;
+
+    //! True for float formats
+    bool isFloat;
+
+    //! True for signed integer and float formats
+    bool isSigned;
+
+    //! True for big endian formats
+    bool isBigEndian;
+} SoapySDRFormatDescriptor;
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -83,6 +136,22 @@ extern "C" {
  */
 SOAPY_SDR_API size_t SoapySDR_formatToSize(const char *format);
 
+/*!
+ * Get the descriptor of the specified format.
+ * The format is interned on the first call,
+ * later calls for the same format return the same ID.
+ * \param format a format string
+ * \return the format descriptor, the ID is 0 for a NULL or empty format
+ */
+SOAPY_SDR_API SoapySDRFormatDescriptor SoapySDR_formatToDescriptor(const char *format);
+
+/*!
+ * Get the descriptor of an interned format ID.
+ * \param id the ID of a format descriptor
+ * \return the format descriptor, the ID is 0 when the ID was not interned
+ */
+SOAPY_SDR_API SoapySDRFormatDescriptor SoapySDR_formatIdToDescriptor(const unsigned id);
+
 #ifdef __cplusplus
 }
 #endif
@@ -24,4 +24,33 @@ namespace SoapySDR
  */
 SOAPY_SDR_API size_t formatToSize(const std::string &format);
 
+//! A compact descriptor of a format string, see SoapySDRFormatDescriptor
+typedef SoapySDRFormatDescriptor FormatDescriptor;
+
+/*!
+ * Get the size of a single element in the specified format.
+ * \param format a format descriptor
+ * \return the size of an element in bytes
+ */
+static inline size_t formatToSize(const FormatDescriptor &format)
+{
+    return format.size;
+}
+
+/*!
+ * Get the descriptor of the specified format.
+ * The format is interned on the first call,
+ * later calls for the same format return the same ID.
+ * \param format a format string
+ * \return the format descriptor, the ID is 0 for an empty format
+ */
+SOAPY_SDR_API FormatDescriptor formatToDescriptor(const std::string &format);
+
+/*!
+ * Get the descriptor of an interned format ID.
+ * \param id the ID of a format descriptor
+ * \return the format descriptor, the ID is 0 when the ID was not interned
+ */
+SOAPY_SDR_API FormatDescriptor formatIdToDescriptor(const unsigned id);
+
 }
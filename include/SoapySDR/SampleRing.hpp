@@ -0,0 +1,241 @@
+///
+/// \file SoapySDR/SampleRing.hpp
+///
+/// Lock-free ring of timestamped sample blocks between two stream threads.
+///
+/// \copyright
+/// Copyright (c) 2021-2021 Josh Blum
+/// SPDX-License-Identifier: BSL-1.0
+///
+
+#pragma once
+#include <SoapySDR/Errors.h>
+#include <vector>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+#include <stdexcept>
+#include <cstddef> //size_t
+#include <cstdint> //uintptr_t
+
+namespace SoapySDR
+{
+
+/*!
+ * A SampleRing passes blocks of samples from one producer thread
+ * to one consumer thread, such as from a driver's USB or network thread
+ * to readStream(), without a lock on the fast path.
+ *
+ * The blocks are preallocated when the ring is created, one buffer per
+ * channel, and each buffer is aligned to a cache line. The producer fills
+ * a block in place and commits it with the elements, flags and time.
+ * The consumer reads a block in place and releases it to the producer.
+ *
+ * When the ring is full, the producer drops its data and counts an
+ * overflow. The next block which is committed carries the overflow,
+ * and acquireRead() returns SOAPY_SDR_OVERFLOW once before that block,
+ * so the gap is reported where it is in the stream, like readStream().
+ * The total from getNumOverflows() can implement readStreamStatus().
+ *
+ * The consumer only sleeps when the ring is empty. The producer only
+ * takes the lock to wake the consumer when the consumer is sleeping.
+ */
+class SampleRing
+{
+public:
+
+    //! The alignment of each buffer and of the producer and consumer state
+    static const size_t ALIGNMENT = 64;
+
+    /*!
+     * Create a ring with a fixed number of blocks.
+     * \throws invalid_argument when the number of blocks is zero
+     * \param numChans the number of channels in each block
+     * \param numBlocks the number of blocks in the ring
+     * \param blockElems the maximum elements per block
+     * \param elemSize the bytes per element
+     */
+    SampleRing(const size_t numChans, const size_t numBlocks, const size_t blockElems, const size_t elemSize):
+        _numChans(numChans),
+        _numBlocks(numBlocks),
+        _blockElems(blockElems),
+        _blocks(numBlocks),
+        _buffs(numBlocks*numChans),
+        _writeIndex(0),
+        _dropped(0),
+        _readIndex(0),
+        _reported(false),
+        _waiting(false),
+        _numOverflows(0)
+    {
+        if (numBlocks == 0) throw std::invalid_argument("SampleRing() numBlocks must be at least 1");
+        const size_t chanBytes = (blockElems*elemSize + ALIGNMENT-1) & ~(ALIGNMENT-1);
+        _pool.resize(_buffs.size()*chanBytes + ALIGNMENT);
+        const size_t skew = size_t(reinterpret_cast<uintptr_t>(_pool.data()) & (ALIGNMENT-1));
+        char *base = _pool.data() + ((ALIGNMENT-skew) & (ALIGNMENT-1));
+        for (size_t i = 0; i < _buffs.size(); i++) _buffs[i] = base + i*chanBytes;
+    }
+
+    //! Get the maximum elements per block
+    size_t getBlockElems(void) const
+    {
+        return _blockElems;
+    }
+
+    //! Get the total number of overflows, which only the producer increments
+    size_t getNumOverflows(void) const
+    {
+        return _numOverflows.load(std::memory_order_relaxed);
+    }
+
+    /*******************************************************************
+     * Producer API
+     ******************************************************************/
+
+    /*!
+     * Get the buffers of the next free block.
+     * When the ring is full, an overflow is counted,
+     * and the producer should drop the data that it has.
+     * \param [out] buffs an array of void* buffers num chans in size
+     * \return true when there is a free block, false for an overflow
+     */
+    bool acquireWrite(void **buffs)
+    {
+        const size_t index = _writeIndex.load(std::memory_order_relaxed);
+        if (index - _readIndex.load(std::memory_order_acquire) == _numBlocks)
+        {
+            _dropped++;
+            _numOverflows.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        const size_t slot = index % _numBlocks;
+        for (size_t ch = 0; ch < _numChans; ch++) buffs[ch] = _buffs[slot*_numChans+ch];
+        return true;
+    }
+
+    /*!
+     * Commit the block from acquireWrite() to the consumer.
+     * \param numElems the number of elements written to each buffer
+     * \param flags the flags for the consumer, such as SOAPY_SDR_HAS_TIME
+     * \param timeNs the timestamp of the first element in nanoseconds
+     */
+    void commitWrite(const size_t numElems, const int flags = 0, const long long timeNs = 0)
+    {
+        const size_t index = _writeIndex.load(std::memory_order_relaxed);
+        Block &block = _blocks[index % _numBlocks];
+        block.numElems = numElems;
+        block.flags = flags;
+        block.timeNs = timeNs;
+        block.overflows = _dropped;
+        _dropped = 0;
+
+        //publish the block, then wake a sleeping consumer (seq_cst pairs with the consumer)
+        _writeIndex.store(index+1, std::memory_order_seq_cst);
+        if (_waiting.load(std::memory_order_seq_cst))
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _cond.notify_one();
+        }
+    }
+
+    /*******************************************************************
+     * Consumer API
+     ******************************************************************/
+
+    /*!
+     * Wait for the next committed block, and get its buffers.
+     * The timeout and return values match Device::readStream().
+     * Only a block is released with releaseRead(): after SOAPY_SDR_OVERFLOW
+     * or SOAPY_SDR_TIMEOUT, there is no block, and the next call gets
+     * the block which follows the overflow.
+     * \param [out] buffs an array of const void* buffers num chans in size
+     * \param [out] flags the flags from commitWrite()
+     * \param [out] timeNs the timestamp from commitWrite()
+     * \param timeoutUs the timeout in microseconds
+     * \return the number of elements per buffer, SOAPY_SDR_TIMEOUT, or SOAPY_SDR_OVERFLOW
+     */
+    int acquireRead(const void **buffs, int &flags, long long &timeNs, const long timeoutUs = 100000)
+    {
+        const size_t index = _readIndex.load(std::memory_order_relaxed);
+        if (not this->waitRead(index, timeoutUs)) return SOAPY_SDR_TIMEOUT;
+
+        //the overflow is returned before the block which follows the dropped data
+        const Block &block = _blocks[index % _numBlocks];
+        if (block.overflows != 0 and not _reported)
+        {
+            _reported = true;
+            flags = 0;
+            timeNs = 0;
+            return SOAPY_SDR_OVERFLOW;
+        }
+        const size_t slot = index % _numBlocks;
+        for (size_t ch = 0; ch < _numChans; ch++) buffs[ch] = _buffs[slot*_numChans+ch];
+        flags = block.flags;
+        timeNs = block.timeNs;
+        return int(block.numElems);
+    }
+
+    //! Release the block from acquireRead() back to the producer, only after a block was returned
+    void releaseRead(void)
+    {
+        _reported = false;
+        _readIndex.store(_readIndex.load(std::memory_order_relaxed)+1, std::memory_order_release);
+    }
+
+private:
+    SampleRing(const SampleRing &) = delete;
+    SampleRing &operator=(const SampleRing &) = delete;
+
+    //! Wait until the block at index is committed, sleeping only when the ring is empty
+    bool waitRead(const size_t index, const long timeoutUs)
+    {
+        if (_writeIndex.load(std::memory_order_acquire) != index) return true;
+        if (timeoutUs <= 0) return false;
+
+        const auto exitTime = std::chrono::steady_clock::now() + std::chrono::microseconds(timeoutUs);
+        std::unique_lock<std::mutex> lock(_mutex);
+        _waiting.store(true, std::memory_order_seq_cst);
+        const bool ready = _cond.wait_until(lock, exitTime, [this, index]{
+            return _writeIndex.load(std::memory_order_seq_cst) != index;});
+        _waiting.store(false, std::memory_order_relaxed);
+        return ready;
+    }
+
+    struct Block
+    {
+        size_t numElems;
+        int flags;
+        long long timeNs;
+        size_t overflows;
+    };
+
+    const size_t _numChans;
+    const size_t _numBlocks;
+    const size_t _blockElems;
+    std::vector<Block> _blocks;
+    std::vector<void *> _buffs;
+    std::vector<char> _pool;
+
+    //the groups of state are apart by a cache line of padding,
+    //as alignas() on members is not honored by new before C++17
+
+    //producer state, on its own cache line
+    char _producerPad[ALIGNMENT];
+    std::atomic<size_t> _writeIndex;
+    size_t _dropped;
+
+    //consumer state, on its own cache line
+    char _consumerPad[ALIGNMENT];
+    std::atomic<size_t> _readIndex;
+    bool _reported;
+
+    //the sleeping consumer, on its own cache line
+    char _waitingPad[ALIGNMENT];
+    std::atomic<bool> _waiting;
+    std::atomic<size_t> _numOverflows;
+    std::mutex _mutex;
+    std::condition_variable _cond;
+};
+
+}
@@ -36,7 +36,7 @@
  * And <i>extra</i> is empty for releases but set on development branches.
  * The ABI should remain constant across patch releases of the library.
  */
-#define SOAPY_SDR_ABI_VERSION "0.8"
+#define SOAPY_SDR_ABI_VERSION "0.8-1"
 
 /*!
  * Compatibility define for GPIO access API with masks
@@ -163,6 +163,11 @@
  */
 #define SOAPY_SDR_API_HAS_PARALLEL_STRING_MAKE
 
+/*!
+ * Compatibility define for the async stream API
+ */
+#define SOAPY_SDR_API_HAS_ASYNC_STREAM_API
+
 #ifdef __cplusplus
 extern "C" {
 #endif
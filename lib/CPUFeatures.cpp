@@ -0,0 +1,58 @@
+// Copyright (c) 2021-2021 Josh Blum
+// SPDX-License-Identifier: BSL-1.0
+
+#include "CPUFeatures.hpp"
+#include <cstring> //memcpy
+#include <cstdlib> //getenv
+
+#ifdef SOAPY_SDR_X86_DISPATCH
+#include <cpuid.h>
+#endif
+
+static CPUFeatures detectCPUFeatures(void)
+{
+    CPUFeatures features = {};
+    #ifdef SOAPY_SDR_X86_DISPATCH
+    __builtin_cpu_init();
+    features.sse41 = __builtin_cpu_supports("sse4.1") != 0;
+    features.avx2 = __builtin_cpu_supports("avx2") != 0;
+    features.avx512bw = __builtin_cpu_supports("avx512f") != 0 and __builtin_cpu_supports("avx512bw") != 0;
+    #endif
+
+    //limit the kernels to an older extension, such as to test each dispatch level
+    const char *maxIsa = std::getenv("SOAPY_SDR_MAX_ISA");
+    const std::string isa((maxIsa == nullptr)?"":maxIsa);
+    if (isa == "generic" or isa == "sse41" or isa == "avx2")
+    {
+        features.avx512bw = false;
+        if (isa != "avx2") features.avx2 = false;
+        if (isa == "generic") features.sse41 = false;
+    }
+    return features;
+}
+
+const CPUFeatures &getCPUFeatures(void)
+{
+    static const CPUFeatures features(detectCPUFeatures());
+    return features;
+}
+
+std::string getCPUModel(void)
+{
+    std::string model;
+    #ifdef SOAPY_SDR_X86_DISPATCH
+    //the brand string is spread over three extended cpuid leaves
+    unsigned int regs[4];
+    if (__get_cpuid(0x80000000, regs+0, regs+1, regs+2, regs+3) == 0 or regs[0] < 0x80000004) return model;
+    char brand[48];
+    for (unsigned int leaf = 0; leaf < 3; leaf++)
+    {
+        __get_cpuid(0x80000002+leaf, regs+0, regs+1, regs+2, regs+3);
+        std::memcpy(brand+leaf*16, regs, 16);
+    }
+    model.assign(brand, strnlen(brand, sizeof(brand)));
+    model.erase(0, model.find_first_not_of(' '));
+    model.erase(model.find_last_not_of(' ')+1);
+    #endif
+    return model;
+}
@@ -0,0 +1,31 @@
+// Copyright (c) 2021-2021 Josh Blum
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+#include <string>
+
+/*******************************************************************
+ * Runtime detection of the host SIMD instruction set extensions.
+ * Kernels for a particular extension are compiled with per-function
+ * target attributes, so this is only available on x86 with GCC/Clang.
+ ******************************************************************/
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define SOAPY_SDR_X86_DISPATCH
+#endif
+
+struct CPUFeatures
+{
+    bool sse41;
+    bool avx2;
+    bool avx512bw;
+};
+
+/*!
+ * Get the features of the host CPU, detected once on first use.
+ * The SOAPY_SDR_MAX_ISA environment variable clears the features above
+ * a level: "generic", "sse41", or "avx2"; other values are ignored.
+ */
+const CPUFeatures &getCPUFeatures(void);
+
+//! Get the model name of the host CPU, or an empty string when unknown
+std::string getCPUModel(void);
@@ -2,29 +2,296 @@
 // Copyright (c) 2018-2018 Josh Blum
 // SPDX-License-Identifier: BSL-1.0
 
+#include "CPUFeatures.hpp"
 #include <SoapySDR/ConverterRegistry.hpp>
 #include <algorithm>
 #include <stdexcept>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <memory>
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include <cstdlib> //atoi
+#include <cstdint> //uint64_t
+#include <queue>
+#include <deque>
+#include <condition_variable>
+#include <unordered_map>
 
 void lateLoadDefaultConverters(void);
 
-static SoapySDR::ConverterRegistry::FormatConverters formatConverters;
+/***********************************************************************
+ * Registry storage
+ *
+ * The converters are published as immutable snapshots of the map.
+ * Readers never lock: they pin the current epoch, load the snapshot,
+ * and release the epoch when done. Writers are serialized by a mutex,
+ * copy and modify the current snapshot, publish the copy, flip the
+ * epoch, and wait for the readers of the previous epoch to drain
+ * before deleting the old snapshot.
+ *
+ * There are only two reader counts, so a reader which pins a stale
+ * epoch would be counted against the parity that the writer after
+ * next waits on, and its snapshot could be deleted under it.
+ * Readers check that the epoch did not move while they pinned it,
+ * and pin again when it did.
+ **********************************************************************/
+typedef SoapySDR::ConverterRegistry::FunctionPriority FunctionPriority;
+typedef SoapySDR::ConverterRegistry::FunctionVariant FunctionVariant;
+
+template <typename Function>
+using FunctionMap = std::map<std::string, std::map<std::string, std::map<FunctionPriority, Function>>>;
+
+struct Snapshot
+{
+  FunctionMap<SoapySDR::ConverterRegistry::ConverterFunction> converters;
+  FunctionMap<SoapySDR::ConverterRegistry::ConverterFunction> saturatingConverters;
+  FunctionMap<SoapySDR::ConverterRegistry::ConverterFunction> streamingConverters;
+  FunctionMap<SoapySDR::ConverterRegistry::DeinterleaveFunction> deinterleavers;
+  FunctionMap<SoapySDR::ConverterRegistry::InterleaveFunction> interleavers;
+  FunctionMap<SoapySDR::ConverterRegistry::CorrectionFunction> correctors;
+  FunctionMap<SoapySDR::ConverterRegistry::StatisticsFunction> statistics;
+
+  //converter priorities chosen by autotune
+  std::map<std::string, std::map<std::string, FunctionPriority>> tunedPriorities;
+
+  //path costs per element of the highest priority converters measured by autotune
+  std::map<std::string, std::map<std::string, double>> tunedPathCosts;
+
+  //highest priority converters keyed by the source and target format IDs
+  std::unordered_map<uint64_t, SoapySDR::ConverterRegistry::ConverterFunction> converterIndex;
+};
+
+static uint64_t formatIdPair(const unsigned sourceId, const unsigned targetId)
+{
+  return (uint64_t(sourceId) << 32) | targetId;
+}
+
+struct RegistryState
+{
+  RegistryState(void):
+    snapshot(nullptr),
+    epoch(0)
+  {
+    readers[0] = 0;
+    readers[1] = 0;
+  }
+
+  ~RegistryState(void)
+  {
+    delete snapshot.load();
+  }
+
+  std::mutex writerMutex;
+  std::atomic<const Snapshot *> snapshot;
+  std::atomic<size_t> epoch;
+  std::atomic<size_t> readers[2];
+};
+
+static RegistryState &getRegistryState(void)
+{
+  static RegistryState state;
+  return state;
+}
+
+/*!
+ * Pins the current snapshot for the lifetime of the reader.
+ * The reader count is incremented before the snapshot is loaded,
+ * and the epoch is unchanged after the increment, so the writer
+ * which flips this epoch next is waiting on this count, and
+ * every writer before it published the snapshot that is loaded.
+ */
+class SnapshotReader
+{
+public:
+  SnapshotReader(void):
+    _state(getRegistryState()),
+    _epoch(pinEpoch(_state))
+  {
+    _snapshot = _state.snapshot.load();
+  }
+
+  ~SnapshotReader(void)
+  {
+    _state.readers[_epoch]--;
+  }
+
+  const Snapshot *operator->(void) const
+  {
+    static const Snapshot empty;
+    return (_snapshot == nullptr)?&empty:_snapshot;
+  }
+
+  //! Find the priority map for a conversion, or nullptr when not registered
+  template <typename Function>
+  const std::map<FunctionPriority, Function> *find(FunctionMap<Function> Snapshot::*functions, const std::string &sourceFormat, const std::string &targetFormat) const
+  {
+    const auto &formatFunctions = this->operator->()->*functions;
+    const auto srcIt = formatFunctions.find(sourceFormat);
+    if (srcIt == formatFunctions.end()) return nullptr;
+    const auto tgtIt = srcIt->second.find(targetFormat);
+    if (tgtIt == srcIt->second.end()) return nullptr;
+    return &tgtIt->second;
+  }
+
+private:
+  //! Increment the reader count of the current epoch, and return the count index
+  static size_t pinEpoch(RegistryState &state)
+  {
+    while (true)
+      {
+        const size_t epoch = state.epoch.load();
+        state.readers[epoch % 2]++;
+        if (state.epoch.load() == epoch) return epoch % 2;
+        state.readers[epoch % 2]--;
+      }
+  }
+
+  RegistryState &_state;
+  const size_t _epoch;
+  const Snapshot *_snapshot;
+};
+
+/*!
+ * Publish a modified copy of the current snapshot.
+ * The modifier returns false to leave the registry unchanged.
+ */
+template <typename Modifier>
+static void updateSnapshot(const Modifier &modify)
+{
+  auto &state = getRegistryState();
+  std::lock_guard<std::mutex> lock(state.writerMutex);
+
+  //the writer mutex is held, so the snapshot cannot change under us
+  const Snapshot *current = state.snapshot.load();
+  std::unique_ptr<Snapshot> next((current == nullptr)?new Snapshot():new Snapshot(*current));
+  if (not modify(*next)) return;
+  state.snapshot.store(next.release());
+
+  //readers that pin the new epoch are guaranteed to load the new snapshot
+  const size_t previous = state.epoch.fetch_add(1) % 2;
+  while (state.readers[previous].load() != 0) std::this_thread::yield();
+  delete current;
+}
+
+//! Update the format ID index after a converter registration
+static void indexFunction(Snapshot &snapshot, FunctionMap<SoapySDR::ConverterRegistry::ConverterFunction> Snapshot::*functions, const std::string &sourceFormat, const std::string &targetFormat)
+{
+  if (functions != &Snapshot::converters) return;
+  const auto key = formatIdPair(SoapySDR::formatToDescriptor(sourceFormat).id, SoapySDR::formatToDescriptor(targetFormat).id);
+  snapshot.converterIndex[key] = snapshot.converters[sourceFormat][targetFormat].rbegin()->second;
+}
+
+//! The other function maps are not indexed
+template <typename Function>
+static void indexFunction(Snapshot &, FunctionMap<Function> Snapshot::*, const std::string &, const std::string &)
+{
+}
+
+//! Publish a new snapshot with the function added, unless the priority is already taken
+template <typename Function>
+static void registerFunction(FunctionMap<Function> Snapshot::*functions, const char *what, const std::string &sourceFormat, const std::string &targetFormat, const FunctionPriority &priority, Function function)
+{
+  updateSnapshot([&](Snapshot &snapshot)
+  {
+    auto &targetPriorities = (snapshot.*functions)[sourceFormat][targetFormat];
+    if (targetPriorities.count(priority) != 0)
+      {
+        SoapySDR::logf(SOAPY_SDR_ERROR, "SoapySDR::ConverterRegistry(%s, %s, %s) duplicate %s registration", sourceFormat.c_str(), targetFormat.c_str(), std::to_string(priority).c_str(), what);
+        return false;
+      }
+    targetPriorities[priority] = function;
+    indexFunction(snapshot, functions, sourceFormat, targetFormat);
+
+    //a new function may beat the one chosen by autotune
+    snapshot.tunedPriorities[sourceFormat].erase(targetFormat);
+    snapshot.tunedPathCosts[sourceFormat].erase(targetFormat);
+    return true;
+  });
+}
+
+//! Get the priorities registered for a conversion
+template <typename Function>
+static std::vector<FunctionPriority> listFunctionPriorities(FunctionMap<Function> Snapshot::*functions, const std::string &sourceFormat, const std::string &targetFormat)
+{
+  lateLoadDefaultConverters();
+
+  std::vector<FunctionPriority> priorities;
+  const SnapshotReader reader;
+  const auto *targetPriorities = reader.find(functions, sourceFormat, targetFormat);
+  if (targetPriorities == nullptr) return priorities;
+  for (const auto &it : *targetPriorities) priorities.push_back(it.first);
+  return priorities;
+}
+
+//! Get the function for a conversion, priority < 0 selects the highest available priority
+template <typename Function>
+static Function getRegisteredFunction(FunctionMap<Function> Snapshot::*functions, const char *what, const std::string &sourceFormat, const std::string &targetFormat, const int priority)
+{
+  lateLoadDefaultConverters();
+
+  const SnapshotReader reader;
+  const auto *targetPriorities = reader.find(functions, sourceFormat, targetFormat);
+  if (targetPriorities == nullptr or targetPriorities->empty())
+    {
+      throw std::runtime_error(std::string("ConverterRegistry::")+what+"() conversion not registered; "
+                               "sourceFormat="+sourceFormat+", targetFormat="+targetFormat);
+    }
+  if (priority < 0) return targetPriorities->rbegin()->second;
+
+  const auto prioIt = targetPriorities->find(FunctionPriority(priority));
+  if (prioIt == targetPriorities->end())
+    {
+      throw std::runtime_error(std::string("ConverterRegistry::")+what+"() conversion priority not registered; "
+                               "sourceFormat="+sourceFormat+", targetFormat="+targetFormat+", priority="+std::to_string(priority));
+    }
+  return prioIt->second;
+}
 
 SoapySDR::ConverterRegistry::ConverterRegistry(const std::string &sourceFormat, const std::string &targetFormat, const FunctionPriority &priority, ConverterFunction converterFunction)
 {
-  if (formatConverters.count(sourceFormat) == 0)
-    ;
-  else if (formatConverters[sourceFormat].count(targetFormat) == 0)
-    ;
-  else if (formatConverters[sourceFormat][targetFormat].count(priority) != 0)
+  registerFunction(&Snapshot::converters, "converter", sourceFormat, targetFormat, priority, converterFunction);
+}
+
+//! The converters of a variant, the WRAPPING variant is the default set of converters
+static FunctionMap<SoapySDR::ConverterRegistry::ConverterFunction> Snapshot::*variantConverters(const FunctionVariant variant)
+{
+  switch (variant)
     {
-      SoapySDR::logf(SOAPY_SDR_ERROR, "SoapySDR::ConverterRegistry(%s, %s, %s) duplicate registration", sourceFormat.c_str(), targetFormat.c_str(), std::to_string(priority).c_str());
-      return;
+    case SoapySDR::ConverterRegistry::SATURATING: return &Snapshot::saturatingConverters;
+    case SoapySDR::ConverterRegistry::STREAMING: return &Snapshot::streamingConverters;
+    default: return &Snapshot::converters;
     }
-  
-  formatConverters[sourceFormat][targetFormat][priority] = converterFunction;
+}
 
-  return;
+SoapySDR::ConverterRegistry::ConverterRegistry(const std::string &sourceFormat, const std::string &targetFormat, const FunctionPriority &priority, const FunctionVariant &variant, ConverterFunction converterFunction)
+{
+  const char *what = "converter";
+  if (variant == SATURATING) what = "saturating converter";
+  if (variant == STREAMING) what = "streaming converter";
+  registerFunction(variantConverters(variant), what, sourceFormat, targetFormat, priority, converterFunction);
+}
+
+SoapySDR::ConverterRegistry::ConverterRegistry(const std::string &sourceFormat, const std::string &targetFormat, const FunctionPriority &priority, DeinterleaveFunction deinterleaveFunction)
+{
+  registerFunction(&Snapshot::deinterleavers, "deinterleave", sourceFormat, targetFormat, priority, deinterleaveFunction);
+}
+
+SoapySDR::ConverterRegistry::ConverterRegistry(const std::string &sourceFormat, const std::string &targetFormat, const FunctionPriority &priority, InterleaveFunction interleaveFunction)
+{
+  registerFunction(&Snapshot::interleavers, "interleave", sourceFormat, targetFormat, priority, interleaveFunction);
+}
+
+SoapySDR::ConverterRegistry::ConverterRegistry(const std::string &sourceFormat, const std::string &targetFormat, const FunctionPriority &priority, CorrectionFunction correctionFunction)
+{
+  registerFunction(&Snapshot::correctors, "correction", sourceFormat, targetFormat, priority, correctionFunction);
+}
+
+SoapySDR::ConverterRegistry::ConverterRegistry(const std::string &sourceFormat, const std::string &targetFormat, const FunctionPriority &priority, StatisticsFunction statisticsFunction)
+{
+  registerFunction(&Snapshot::statistics, "statistics", sourceFormat, targetFormat, priority, statisticsFunction);
 }
 
 std::vector<std::string> SoapySDR::ConverterRegistry::listTargetFormats(const std::string &sourceFormat)
@@ -33,10 +300,13 @@ std::vector<std::string> SoapySDR::ConverterRegistry::listTargetFormats(const st
 
   std::vector<std::string> targets;
 
-  if (formatConverters.count(sourceFormat) == 0)
+  const SnapshotReader reader;
+  const auto &formatConverters = reader->converters;
+  const auto srcIt = formatConverters.find(sourceFormat);
+  if (srcIt == formatConverters.end())
     return targets;
 
-  for(const auto &it:formatConverters[sourceFormat])
+  for(const auto &it:srcIt->second)
     {
       std::string targetFormat = it.first;
       targets.push_back(targetFormat);
@@ -52,10 +322,11 @@ std::vector<std::string> SoapySDR::ConverterRegistry::listSourceFormats(const st
 
   std::vector<std::string> sources;
 
-  for(const auto &it:formatConverters)
+  const SnapshotReader reader;
+  for(const auto &it:reader->converters)
     {
       std::string sourceFormat = it.first;
-      if (formatConverters[sourceFormat].count(targetFormat) > 0)
+      if (it.second.count(targetFormat) > 0)
         sources.push_back(sourceFormat);
     }
   
@@ -65,77 +336,277 @@ std::vector<std::string> SoapySDR::ConverterRegistry::listSourceFormats(const st
 
 std::vector<SoapySDR::ConverterRegistry::FunctionPriority> SoapySDR::ConverterRegistry::listPriorities(const std::string &sourceFormat, const std::string &targetFormat)
 {
-  lateLoadDefaultConverters();
+  return listFunctionPriorities(&Snapshot::converters, sourceFormat, targetFormat);
+}
 
-  std::vector<FunctionPriority> priorities;
-  
-  if (formatConverters.count(sourceFormat) == 0)
-    ;
-  else if (formatConverters[sourceFormat].count(targetFormat) == 0)
-    ;
-  else if (formatConverters[sourceFormat][targetFormat].size() == 0)
-    ;
-  else
-    {
-      for(const auto &it:formatConverters[sourceFormat][targetFormat])
+std::vector<SoapySDR::ConverterRegistry::FunctionPriority> SoapySDR::ConverterRegistry::listPriorities(const std::string &sourceFormat, const std::string &targetFormat, const FunctionVariant &variant)
+{
+  return listFunctionPriorities(variantConverters(variant), sourceFormat, targetFormat);
+}
+
+/***********************************************************************
+ * Autotune
+ *
+ * When enabled, the first getFunction() call for a conversion with
+ * multiple priorities times each candidate and publishes the fastest
+ * in the snapshot, so later lookups are as cheap as without autotune.
+ * Results can be stored in a file, keyed by the CPU model.
+ **********************************************************************/
+std::string getEnvImpl(const char *name);
+
+//! Elements converted per timed call, about the size of a stream MTU
+static const size_t AUTOTUNE_NUM_ELEMS = 4096;
+
+//! The candidates are timed in turn this many times, and the best time of each is kept
+static const size_t AUTOTUNE_NUM_TRIALS = 8;
+
+typedef std::map<FunctionPriority, SoapySDR::ConverterRegistry::ConverterFunction> ConverterPriorities;
+
+static bool envFlagSet(const char *name)
+{
+  const auto value = getEnvImpl(name);
+  return not value.empty() and value != "0" and value != "false";
+}
+
+static std::atomic<bool> &getAutotuneFlag(void)
+{
+  static std::atomic<bool> flag(envFlagSet("SOAPY_SDR_CONVERTER_AUTOTUNE"));
+  return flag;
+}
+
+struct AutotuneCache
+{
+  AutotuneCache(void):
+    path(getEnvImpl("SOAPY_SDR_CONVERTER_AUTOTUNE_CACHE")),
+    cpuModel(getCPUModel())
+  {
+    if (cpuModel.empty()) cpuModel = "unknown";
+  }
+
+  std::mutex mutex;
+  std::string path;
+  std::string cpuModel;
+};
+
+static AutotuneCache &getAutotuneCache(void)
+{
+  static AutotuneCache cache;
+  return cache;
+}
+
+//! Find a stored result, the file has a tab-separated line per result: cpu model, source, target, priority
+static bool loadTunedPriority(const AutotuneCache &cache, const std::string &sourceFormat, const std::string &targetFormat, const ConverterPriorities &candidates, FunctionPriority &priority)
+{
+  bool found = false;
+  std::ifstream file(cache.path);
+  std::string line;
+  while (std::getline(file, line))
+    {
+      std::vector<std::string> fields;
+      std::istringstream fieldStream(line);
+      for (std::string field; std::getline(fieldStream, field, '\t');) fields.push_back(field);
+      if (fields.size() != 4) continue;
+      if (fields[0] != cache.cpuModel or fields[1] != sourceFormat or fields[2] != targetFormat) continue;
+
+      //the converters may have changed since the result was stored
+      const auto stored = FunctionPriority(std::atoi(fields[3].c_str()));
+      if (candidates.count(stored) == 0) continue;
+      priority = stored;
+      found = true;
+    }
+  return found;
+}
+
+static void storeTunedPriority(const AutotuneCache &cache, const std::string &sourceFormat, const std::string &targetFormat, const FunctionPriority priority)
+{
+  std::ofstream file(cache.path, std::ios::app);
+  file << cache.cpuModel << '\t' << sourceFormat << '\t' << targetFormat << '\t' << int(priority) << std::endl;
+  if (not file) SoapySDR::logf(SOAPY_SDR_WARNING, "ConverterRegistry autotune cannot write %s", cache.path.c_str());
+}
+
+//! Time one call of a converter over AUTOTUNE_NUM_ELEMS elements
+static std::chrono::high_resolution_clock::duration timeConverter(const SoapySDR::ConverterRegistry::ConverterFunction function, std::vector<char> &srcBuff, std::vector<char> &dstBuff)
+{
+  const auto startTime = std::chrono::high_resolution_clock::now();
+  function(srcBuff.data(), dstBuff.data(), AUTOTUNE_NUM_ELEMS, 1.0);
+  return std::chrono::high_resolution_clock::now() - startTime;
+}
+
+static FunctionPriority measureFastestPriority(const std::string &sourceFormat, const std::string &targetFormat, const ConverterPriorities &candidates)
+{
+  //custom formats of unknown size cannot be timed safely
+  const size_t sourceSize = SoapySDR::formatToSize(sourceFormat);
+  const size_t targetSize = SoapySDR::formatToSize(targetFormat);
+  if (sourceSize == 0 or targetSize == 0) return candidates.rbegin()->first;
+
+  std::vector<char> srcBuff(AUTOTUNE_NUM_ELEMS*sourceSize);
+  std::vector<char> dstBuff(AUTOTUNE_NUM_ELEMS*targetSize);
+  std::map<FunctionPriority, std::chrono::high_resolution_clock::duration> bestTimes;
+  for (size_t trial = 0; trial < AUTOTUNE_NUM_TRIALS; trial++)
+    {
+      for (const auto &it : candidates)
         {
-          FunctionPriority priority = it.first;
-          priorities.push_back(priority);
+          const auto elapsed = timeConverter(it.second, srcBuff, dstBuff);
+          if (trial == 0 or elapsed < bestTimes[it.first]) bestTimes[it.first] = elapsed;
         }
     }
-  
-  return priorities;
-  
+
+  //ties go to the higher priority
+  auto fastest = bestTimes.rbegin();
+  for (auto it = bestTimes.rbegin(); it != bestTimes.rend(); ++it)
+    {
+      if (it->second < fastest->second) fastest = it;
+    }
+  return fastest->first;
+}
+
+//! Get the autotuned converter, or nullptr when there is no choice to make
+static SoapySDR::ConverterRegistry::ConverterFunction getTunedFunction(const std::string &sourceFormat, const std::string &targetFormat)
+{
+  ConverterPriorities candidates;
+  {
+    const SnapshotReader reader;
+    const auto *targetPriorities = reader.find(&Snapshot::converters, sourceFormat, targetFormat);
+    if (targetPriorities == nullptr or targetPriorities->size() < 2) return nullptr;
+
+    const auto srcIt = reader->tunedPriorities.find(sourceFormat);
+    if (srcIt != reader->tunedPriorities.end())
+      {
+        const auto tgtIt = srcIt->second.find(targetFormat);
+        if (tgtIt != srcIt->second.end()) return targetPriorities->at(tgtIt->second);
+      }
+    candidates = *targetPriorities;
+  }
+
+  //the reader is released before publishing, which waits for readers to drain
+  auto &cache = getAutotuneCache();
+  FunctionPriority priority;
+  {
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    if (cache.path.empty() or not loadTunedPriority(cache, sourceFormat, targetFormat, candidates, priority))
+      {
+        priority = measureFastestPriority(sourceFormat, targetFormat, candidates);
+        if (not cache.path.empty()) storeTunedPriority(cache, sourceFormat, targetFormat, priority);
+      }
+  }
+  SoapySDR::logf(SOAPY_SDR_DEBUG, "ConverterRegistry autotune %s -> %s selected priority %d", sourceFormat.c_str(), targetFormat.c_str(), int(priority));
+
+  updateSnapshot([&](Snapshot &snapshot)
+  {
+    //discard the result if converters were registered in the meantime
+    const auto srcIt = snapshot.converters.find(sourceFormat);
+    if (srcIt == snapshot.converters.end()) return false;
+    const auto tgtIt = srcIt->second.find(targetFormat);
+    if (tgtIt == srcIt->second.end() or tgtIt->second != candidates) return false;
+    snapshot.tunedPriorities[sourceFormat][targetFormat] = priority;
+    return true;
+  });
+  return candidates.at(priority);
+}
+
+void SoapySDR::ConverterRegistry::setAutotune(const bool enable)
+{
+  getAutotuneFlag() = enable;
+}
+
+void SoapySDR::ConverterRegistry::setAutotuneCache(const std::string &path)
+{
+  auto &cache = getAutotuneCache();
+  std::lock_guard<std::mutex> lock(cache.mutex);
+  cache.path = path;
 }
 
 SoapySDR::ConverterRegistry::ConverterFunction SoapySDR::ConverterRegistry::getFunction(const std::string &sourceFormat, const std::string &targetFormat)
 {
   lateLoadDefaultConverters();
 
-  if (formatConverters.count(sourceFormat) == 0)
+  if (getAutotuneFlag())
+    {
+      const auto function = getTunedFunction(sourceFormat, targetFormat);
+      if (function != nullptr) return function;
+    }
+
+  const SnapshotReader reader;
+  const auto &formatConverters = reader->converters;
+  const auto srcIt = formatConverters.find(sourceFormat);
+  if (srcIt == formatConverters.end())
     {
       throw std::runtime_error("ConverterRegistry::getFunction() conversion source not registered; "
                                "sourceFormat="+sourceFormat+", targetFormat="+targetFormat);
     }
   
-  if (formatConverters[sourceFormat].count(targetFormat) == 0)
+  const auto tgtIt = srcIt->second.find(targetFormat);
+  if (tgtIt == srcIt->second.end())
     {
       throw std::runtime_error("ConverterRegistry::getFunction() conversion target not registered; "
                                "sourceFormat="+sourceFormat+", targetFormat="+targetFormat);
     }
 
-  if (formatConverters[sourceFormat][targetFormat].size() == 0)
+  if (tgtIt->second.size() == 0)
     {
       throw std::runtime_error("ConverterRegistry::getFunction() no functions found for registered conversion; "
                                "sourceFormat="+sourceFormat+", targetFormat="+targetFormat);
     }
 
-  return formatConverters[sourceFormat][targetFormat].rbegin()->second;
+  return tgtIt->second.rbegin()->second;
+}
+
+SoapySDR::ConverterRegistry::ConverterFunction SoapySDR::ConverterRegistry::getFunction(const FormatDescriptor &sourceFormat, const FormatDescriptor &targetFormat)
+{
+  lateLoadDefaultConverters();
+
+  if (not getAutotuneFlag())
+    {
+      const SnapshotReader reader;
+      const auto it = reader->converterIndex.find(formatIdPair(sourceFormat.id, targetFormat.id));
+      if (it != reader->converterIndex.end()) return it->second;
+    }
+
+  //autotune and the errors are handled by the format string lookup
+  return getFunction(std::string((sourceFormat.format == nullptr)?"":sourceFormat.format),
+                     std::string((targetFormat.format == nullptr)?"":targetFormat.format));
 }
 
 SoapySDR::ConverterRegistry::ConverterFunction SoapySDR::ConverterRegistry::getFunction(const std::string &sourceFormat, const std::string &targetFormat, const FunctionPriority &priority)
 {
   lateLoadDefaultConverters();
 
-  if (formatConverters.count(sourceFormat) == 0)
+  const SnapshotReader reader;
+  const auto &formatConverters = reader->converters;
+  const auto srcIt = formatConverters.find(sourceFormat);
+  if (srcIt == formatConverters.end())
     {
       throw std::runtime_error("ConverterRegistry::getFunction() conversion source not registered; "
                                "sourceFormat="+sourceFormat+", targetFormat="+targetFormat+", priority="+std::to_string(priority));
     }
 
-  if (formatConverters[sourceFormat].count(targetFormat) == 0)
+  const auto tgtIt = srcIt->second.find(targetFormat);
+  if (tgtIt == srcIt->second.end())
     {
       throw std::runtime_error("ConverterRegistry::getFunction() conversion target not registered; "
                                "sourceFormat="+sourceFormat+", targetFormat="+targetFormat+", priority="+std::to_string(priority));
     }
 
-  if (formatConverters[sourceFormat][targetFormat].count(priority) == 0)
+  const auto prioIt = tgtIt->second.find(priority);
+  if (prioIt == tgtIt->second.end())
     {
       throw std::runtime_error("ConverterRegistry::getFunction() conversion priority not registered; "
                                "sourceFormat="+sourceFormat+", targetFormat="+targetFormat+", priority="+std::to_string(priority));
     }
 
-  return formatConverters[sourceFormat][targetFormat][priority];
+  return prioIt->second;
+}
+
+SoapySDR::ConverterRegistry::ConverterFunction SoapySDR::ConverterRegistry::getFunction(const std::string &sourceFormat, const std::string &targetFormat, const FunctionVariant &variant)
+{
+  if (variant == WRAPPING) return getFunction(sourceFormat, targetFormat);
+  return getRegisteredFunction(variantConverters(variant), "getFunction", sourceFormat, targetFormat, -1);
+}
+
+SoapySDR::ConverterRegistry::ConverterFunction SoapySDR::ConverterRegistry::getFunction(const std::string &sourceFormat, const std::string &targetFormat, const FunctionPriority &priority, const FunctionVariant &variant)
+{
+  if (variant == WRAPPING) return getFunction(sourceFormat, targetFormat, priority);
+  return getRegisteredFunction(variantConverters(variant), "getFunction", sourceFormat, targetFormat, priority);
 }
 
 std::vector<std::string> SoapySDR::ConverterRegistry::listAvailableSourceFormats(void)
@@ -143,7 +614,8 @@ std::vector<std::string> SoapySDR::ConverterRegistry::listAvailableSourceFormats
     lateLoadDefaultConverters();
 
     std::vector<std::string> sources;
-    for (const auto &it : formatConverters)
+    const SnapshotReader reader;
+    for (const auto &it : reader->converters)
     {
         if (std::find(sources.begin(), sources.end(), it.first) == sources.end())
         {
@@ -153,3 +625,527 @@ std::vector<std::string> SoapySDR::ConverterRegistry::listAvailableSourceFormats
     std::sort(sources.begin(), sources.end());
     return sources;
 }
+
+std::vector<SoapySDR::ConverterRegistry::FunctionPriority> SoapySDR::ConverterRegistry::listDeinterleavePriorities(const std::string &sourceFormat, const std::string &targetFormat)
+{
+  return listFunctionPriorities(&Snapshot::deinterleavers, sourceFormat, targetFormat);
+}
+
+SoapySDR::ConverterRegistry::DeinterleaveFunction SoapySDR::ConverterRegistry::getDeinterleaveFunction(const std::string &sourceFormat, const std::string &targetFormat)
+{
+  return getRegisteredFunction(&Snapshot::deinterleavers, "getDeinterleaveFunction", sourceFormat, targetFormat, -1);
+}
+
+SoapySDR::ConverterRegistry::DeinterleaveFunction SoapySDR::ConverterRegistry::getDeinterleaveFunction(const std::string &sourceFormat, const std::string &targetFormat, const FunctionPriority &priority)
+{
+  return getRegisteredFunction(&Snapshot::deinterleavers, "getDeinterleaveFunction", sourceFormat, targetFormat, priority);
+}
+
+std::vector<SoapySDR::ConverterRegistry::FunctionPriority> SoapySDR::ConverterRegistry::listInterleavePriorities(const std::string &sourceFormat, const std::string &targetFormat)
+{
+  return listFunctionPriorities(&Snapshot::interleavers, sourceFormat, targetFormat);
+}
+
+SoapySDR::ConverterRegistry::InterleaveFunction SoapySDR::ConverterRegistry::getInterleaveFunction(const std::string &sourceFormat, const std::string &targetFormat)
+{
+  return getRegisteredFunction(&Snapshot::interleavers, "getInterleaveFunction", sourceFormat, targetFormat, -1);
+}
+
+SoapySDR::ConverterRegistry::InterleaveFunction SoapySDR::ConverterRegistry::getInterleaveFunction(const std::string &sourceFormat, const std::string &targetFormat, const FunctionPriority &priority)
+{
+  return getRegisteredFunction(&Snapshot::interleavers, "getInterleaveFunction", sourceFormat, targetFormat, priority);
+}
+
+std::vector<SoapySDR::ConverterRegistry::FunctionPriority> SoapySDR::ConverterRegistry::listCorrectionPriorities(const std::string &sourceFormat, const std::string &targetFormat)
+{
+  return listFunctionPriorities(&Snapshot::correctors, sourceFormat, targetFormat);
+}
+
+SoapySDR::ConverterRegistry::CorrectionFunction SoapySDR::ConverterRegistry::getCorrectionFunction(const std::string &sourceFormat, const std::string &targetFormat)
+{
+  return getRegisteredFunction(&Snapshot::correctors, "getCorrectionFunction", sourceFormat, targetFormat, -1);
+}
+
+SoapySDR::ConverterRegistry::CorrectionFunction SoapySDR::ConverterRegistry::getCorrectionFunction(const std::string &sourceFormat, const std::string &targetFormat, const FunctionPriority &priority)
+{
+  return getRegisteredFunction(&Snapshot::correctors, "getCorrectionFunction", sourceFormat, targetFormat, priority);
+}
+
+SoapySDR::ConverterRegistry::Correction::Correction(void):
+  dcOffset(0.0, 0.0)
+{
+  matrix[0][0] = 1.0;
+  matrix[0][1] = 0.0;
+  matrix[1][0] = 0.0;
+  matrix[1][1] = 1.0;
+}
+
+std::vector<SoapySDR::ConverterRegistry::FunctionPriority> SoapySDR::ConverterRegistry::listStatisticsPriorities(const std::string &sourceFormat, const std::string &targetFormat)
+{
+  return listFunctionPriorities(&Snapshot::statistics, sourceFormat, targetFormat);
+}
+
+SoapySDR::ConverterRegistry::StatisticsFunction SoapySDR::ConverterRegistry::getStatisticsFunction(const std::string &sourceFormat, const std::string &targetFormat)
+{
+  return getRegisteredFunction(&Snapshot::statistics, "getStatisticsFunction", sourceFormat, targetFormat, -1);
+}
+
+SoapySDR::ConverterRegistry::StatisticsFunction SoapySDR::ConverterRegistry::getStatisticsFunction(const std::string &sourceFormat, const std::string &targetFormat, const FunctionPriority &priority)
+{
+  return getRegisteredFunction(&Snapshot::statistics, "getStatisticsFunction", sourceFormat, targetFormat, priority);
+}
+
+SoapySDR::ConverterRegistry::Statistics::Statistics(void):
+  peak(0.0),
+  meanPower(0.0),
+  clipCount(0)
+{
+  return;
+}
+
+/***********************************************************************
+ * Path planning
+ **********************************************************************/
+//! Added to the cost of each hop, so that shorter paths win ties
+static const double PATH_HOP_COST = 1.0;
+
+//! Cost per element of a converter which is not measured, see getPath()
+static double pathEdgeCost(const std::string &sourceFormat, const std::string &targetFormat, const FunctionPriority priority)
+{
+  const size_t sourceSize = SoapySDR::formatToSize(sourceFormat);
+  const size_t targetSize = SoapySDR::formatToSize(targetFormat);
+  const double bytes = sourceSize + targetSize;
+  return PATH_HOP_COST + ((priority > SoapySDR::ConverterRegistry::GENERIC)?bytes/4:bytes);
+}
+
+//! Cost per element of a converter from its best time with autotune, see getPath()
+static double measurePathEdgeCost(const std::string &sourceFormat, const std::string &targetFormat, const SoapySDR::ConverterRegistry::ConverterFunction function)
+{
+  std::vector<char> srcBuff(AUTOTUNE_NUM_ELEMS*SoapySDR::formatToSize(sourceFormat));
+  std::vector<char> dstBuff(AUTOTUNE_NUM_ELEMS*SoapySDR::formatToSize(targetFormat));
+  auto best = timeConverter(function, srcBuff, dstBuff);
+  for (size_t trial = 1; trial < AUTOTUNE_NUM_TRIALS; trial++) best = std::min(best, timeConverter(function, srcBuff, dstBuff));
+  return PATH_HOP_COST + std::chrono::duration<double, std::nano>(best).count()/AUTOTUNE_NUM_ELEMS;
+}
+
+std::vector<std::string> SoapySDR::ConverterRegistry::getPath(const std::string &sourceFormat, const std::string &targetFormat)
+{
+  lateLoadDefaultConverters();
+
+  //copy the graph out of the snapshot, so the reader is not held while measuring;
+  //with autotune, an edge is measured once and its cost is kept in the snapshot
+  struct Edge
+  {
+    std::string targetFormat;
+    FunctionPriority priority;
+    ConverterFunction function;
+    double cost; //negative until known
+  };
+  std::map<std::string, std::vector<Edge>> graph;
+  const bool autotune = getAutotuneFlag();
+  {
+    const SnapshotReader reader;
+    if (reader.find(&Snapshot::converters, sourceFormat, targetFormat) != nullptr) return {sourceFormat, targetFormat};
+    //formats of unknown size cannot be staged in the scratch buffers, see convertPath()
+    for (const auto &src : reader->converters)
+      {
+        if (SoapySDR::formatToSize(src.first) == 0) continue;
+        const auto costsIt = reader->tunedPathCosts.find(src.first);
+        for (const auto &tgt : src.second)
+          {
+            if (tgt.second.empty() or SoapySDR::formatToSize(tgt.first) == 0) continue;
+            const auto priority = tgt.second.rbegin()->first;
+            double cost = -1.0;
+            if (not autotune) cost = pathEdgeCost(src.first, tgt.first, priority);
+            else if (costsIt != reader->tunedPathCosts.end() and costsIt->second.count(tgt.first) != 0) cost = costsIt->second.at(tgt.first);
+            graph[src.first].push_back({tgt.first, priority, tgt.second.rbegin()->second, cost});
+          }
+      }
+  }
+
+  //dijkstra's shortest path from the source format
+  std::vector<std::pair<std::string, const Edge *>> measured;
+  std::map<std::string, double> costs;
+  std::map<std::string, std::string> previous;
+  typedef std::pair<double, std::string> QueueEntry;
+  std::priority_queue<QueueEntry, std::vector<QueueEntry>, std::greater<QueueEntry>> queue;
+  costs[sourceFormat] = 0.0;
+  queue.emplace(0.0, sourceFormat);
+  while (not queue.empty())
+    {
+      const auto entry = queue.top();
+      queue.pop();
+      if (entry.second == targetFormat) break;
+      if (entry.first > costs[entry.second]) continue; //stale entry
+
+      for (auto &edge : graph[entry.second])
+        {
+          if (edge.cost < 0.0)
+            {
+              edge.cost = measurePathEdgeCost(entry.second, edge.targetFormat, edge.function);
+              measured.emplace_back(entry.second, &edge);
+            }
+          const double cost = entry.first + edge.cost;
+          const auto it = costs.find(edge.targetFormat);
+          if (it != costs.end() and it->second <= cost) continue;
+          costs[edge.targetFormat] = cost;
+          previous[edge.targetFormat] = entry.second;
+          queue.emplace(cost, edge.targetFormat);
+        }
+    }
+
+  //keep the measured costs, unless the converter was replaced in the meantime
+  if (not measured.empty()) updateSnapshot([&](Snapshot &snapshot)
+  {
+    bool changed = false;
+    for (const auto &m : measured)
+      {
+        const auto srcIt = snapshot.converters.find(m.first);
+        if (srcIt == snapshot.converters.end()) continue;
+        const auto tgtIt = srcIt->second.find(m.second->targetFormat);
+        if (tgtIt == srcIt->second.end() or tgtIt->second.empty() or tgtIt->second.rbegin()->second != m.second->function) continue;
+        snapshot.tunedPathCosts[m.first][m.second->targetFormat] = m.second->cost;
+        changed = true;
+      }
+    return changed;
+  });
+
+  std::vector<std::string> path;
+  if (previous.count(targetFormat) == 0) return path;
+  for (std::string format = targetFormat; format != sourceFormat; format = previous.at(format)) path.push_back(format);
+  path.push_back(sourceFormat);
+  std::reverse(path.begin(), path.end());
+  return path;
+}
+
+bool SoapySDR::ConverterRegistry::supportsInPlace(const std::string &sourceFormat, const std::string &targetFormat)
+{
+  //a multi-hop path converts through scratch buffers one block at a time,
+  //so it writes each output block after reading the same input block too
+  const size_t sourceSize = SoapySDR::formatToSize(sourceFormat);
+  const size_t targetSize = SoapySDR::formatToSize(targetFormat);
+  if (sourceSize == 0 or targetSize == 0 or targetSize > sourceSize) return false;
+  return not getPath(sourceFormat, targetFormat).empty();
+}
+
+SoapySDR::ConverterRegistry::Handle::Handle(void):
+  _function(nullptr),
+  _streamer(nullptr),
+  _corrector(nullptr),
+  _scaledHop(0),
+  _scaler(1.0),
+  _streamingThreshold(0),
+  _streamingElems(0),
+  _sourceSize(0),
+  _targetSize(0)
+{
+  return;
+}
+
+SoapySDR::ConverterRegistry::Handle::Handle(const std::string &sourceFormat, const std::string &targetFormat, const double scaler):
+  _function(nullptr),
+  _streamer(nullptr),
+  _corrector(nullptr),
+  _scaledHop(0),
+  _scaler(scaler),
+  _streamingThreshold(0),
+  _streamingElems(0),
+  _sourceFormat(sourceFormat),
+  _targetFormat(targetFormat),
+  _sourceSize(SoapySDR::formatToSize(sourceFormat)),
+  _targetSize(SoapySDR::formatToSize(targetFormat))
+{
+  const auto path = ConverterRegistry::getPath(sourceFormat, targetFormat);
+
+  //a direct conversion, or no path at all, which throws the usual error
+  if (path.size() <= 2)
+    {
+      _function = ConverterRegistry::getFunction(sourceFormat, targetFormat);
+      return;
+    }
+
+  //the scaler belongs to the hop to or from a float format,
+  //which is where the direct converters apply it as well
+  bool scaled = false;
+  for (size_t i = 1; i < path.size(); i++)
+    {
+      const bool isFloat = SoapySDR::formatToDescriptor(path[i-1]).isFloat or SoapySDR::formatToDescriptor(path[i]).isFloat;
+      if (isFloat and not scaled)
+        {
+          _scaledHop = _hops.size();
+          scaled = true;
+        }
+      const size_t size = SoapySDR::formatToSize(path[i]);
+      if (size == 0 or SoapySDR::formatToSize(path[i-1]) == 0)
+        {
+          throw std::runtime_error("ConverterRegistry::Handle() conversion path through format of unknown size; "
+                                   "sourceFormat="+sourceFormat+", targetFormat="+targetFormat);
+        }
+      _hops.push_back({ConverterRegistry::getFunction(path[i-1], path[i]), size});
+    }
+}
+
+SoapySDR::ConverterRegistry::Handle::Handle(const std::string &sourceFormat, const std::string &targetFormat, const FunctionPriority &priority, const double scaler):
+  _function(ConverterRegistry::getFunction(sourceFormat, targetFormat, priority)),
+  _streamer(nullptr),
+  _corrector(nullptr),
+  _scaledHop(0),
+  _scaler(scaler),
+  _streamingThreshold(0),
+  _streamingElems(0),
+  _sourceFormat(sourceFormat),
+  _targetFormat(targetFormat),
+  _sourceSize(SoapySDR::formatToSize(sourceFormat)),
+  _targetSize(SoapySDR::formatToSize(targetFormat))
+{
+  return;
+}
+
+SoapySDR::ConverterRegistry::Handle::Handle(const std::string &sourceFormat, const std::string &targetFormat, const FunctionVariant &variant, const double scaler):
+  _function(ConverterRegistry::getFunction(sourceFormat, targetFormat, variant)),
+  _streamer(nullptr),
+  _corrector(nullptr),
+  _scaledHop(0),
+  _scaler(scaler),
+  _streamingThreshold(0),
+  _streamingElems(0),
+  _sourceFormat(sourceFormat),
+  _targetFormat(targetFormat),
+  _sourceSize(SoapySDR::formatToSize(sourceFormat)),
+  _targetSize(SoapySDR::formatToSize(targetFormat))
+{
+  return;
+}
+
+SoapySDR::ConverterRegistry::Handle::Handle(const std::string &sourceFormat, const std::string &targetFormat, const Correction &correction, const double scaler):
+  _function(nullptr),
+  _streamer(nullptr),
+  _corrector(ConverterRegistry::getCorrectionFunction(sourceFormat, targetFormat)),
+  _correction(correction),
+  _scaledHop(0),
+  _scaler(scaler),
+  _streamingThreshold(0),
+  _streamingElems(0),
+  _sourceFormat(sourceFormat),
+  _targetFormat(targetFormat),
+  _sourceSize(SoapySDR::formatToSize(sourceFormat)),
+  _targetSize(SoapySDR::formatToSize(targetFormat))
+{
+  return;
+}
+
+const std::string &SoapySDR::ConverterRegistry::Handle::getSourceFormat(void) const
+{
+  return _sourceFormat;
+}
+
+const std::string &SoapySDR::ConverterRegistry::Handle::getTargetFormat(void) const
+{
+  return _targetFormat;
+}
+
+size_t SoapySDR::ConverterRegistry::Handle::getSourceSize(void) const
+{
+  return _sourceSize;
+}
+
+size_t SoapySDR::ConverterRegistry::Handle::getTargetSize(void) const
+{
+  return _targetSize;
+}
+
+SoapySDR::ConverterRegistry::ConverterFunction SoapySDR::ConverterRegistry::Handle::getFunction(void) const
+{
+  return _function;
+}
+
+void SoapySDR::ConverterRegistry::Handle::setScaler(const double scaler)
+{
+  _scaler = scaler;
+}
+
+double SoapySDR::ConverterRegistry::Handle::getScaler(void) const
+{
+  return _scaler;
+}
+
+void SoapySDR::ConverterRegistry::Handle::setCorrection(const Correction &correction)
+{
+  _correction = correction;
+}
+
+const SoapySDR::ConverterRegistry::Correction &SoapySDR::ConverterRegistry::Handle::getCorrection(void) const
+{
+  return _correction;
+}
+
+void SoapySDR::ConverterRegistry::Handle::setStreamingThreshold(const size_t thresholdBytes)
+{
+  _streamingThreshold = thresholdBytes;
+  _streamer = nullptr;
+  _streamingElems = 0;
+
+  //only direct conversions have a streaming variant to switch to
+  if (thresholdBytes == 0 or _function == nullptr or _targetSize == 0) return;
+  if (ConverterRegistry::listPriorities(_sourceFormat, _targetFormat, STREAMING).empty()) return;
+  _streamer = ConverterRegistry::getFunction(_sourceFormat, _targetFormat, STREAMING);
+  _streamingElems = (thresholdBytes + _targetSize - 1)/_targetSize;
+}
+
+size_t SoapySDR::ConverterRegistry::Handle::getStreamingThreshold(void) const
+{
+  return _streamingThreshold;
+}
+
+/***********************************************************************
+ * Parallel conversion
+ **********************************************************************/
+//! Bytes of source plus target per chunk, sized to stay resident in a core's L2 cache
+static const size_t PARALLEL_CHUNK_BYTES = 128*1024;
+
+//! Chunks hold a multiple of this many elements so vector kernels avoid scalar tails
+static const size_t PARALLEL_CHUNK_ALIGN = 64;
+
+/*!
+ * A pool of worker threads which persist between parallel conversions,
+ * so that a conversion does not pay to create and join its threads.
+ * The pool grows to the most threads that a conversion has asked for.
+ * Each job is a list of tasks, which the calling thread works on too,
+ * and the workers help a job with up to the threads that it asked for.
+ */
+class ParallelPool
+{
+public:
+  //! The pool is never destroyed, so that exit does not wait on the workers
+  static ParallelPool &instance(void)
+  {
+    static ParallelPool *pool = new ParallelPool();
+    return *pool;
+  }
+
+  //! Run the tasks on up to numThreads threads, and return when all are done
+  void run(const std::vector<std::function<void(void)>> &tasks, const size_t numThreads)
+  {
+    Job job;
+    job.tasks = &tasks;
+    job.nextTask = 0;
+    job.numDone = 0;
+    job.numHelpers = 0;
+    job.maxHelpers = std::min(numThreads, tasks.size())-1;
+
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (_threads.size() < job.maxHelpers) _threads.emplace_back(&ParallelPool::workerLoop, this);
+    _jobs.push_back(&job);
+    _workCond.notify_all();
+
+    //the calling thread is one of the workers
+    while (job.nextTask < tasks.size()) this->runNextTask(job, lock);
+    _doneCond.wait(lock, [&job](void){return job.numDone == job.tasks->size();});
+  }
+
+private:
+  struct Job
+  {
+    const std::vector<std::function<void(void)>> *tasks;
+    size_t nextTask;
+    size_t numDone;
+    size_t numHelpers;
+    size_t maxHelpers;
+  };
+
+  //! Run the next task of the job without the lock, the job leaves the queue when its last task is taken
+  void runNextTask(Job &job, std::unique_lock<std::mutex> &lock)
+  {
+    const size_t i = job.nextTask++;
+    if (job.nextTask == job.tasks->size()) _jobs.erase(std::find(_jobs.begin(), _jobs.end(), &job));
+    lock.unlock();
+    (*job.tasks)[i]();
+    lock.lock();
+    if (++job.numDone == job.tasks->size()) _doneCond.notify_all();
+  }
+
+  //! Find a queued job which can take another helper
+  Job *findJob(void) const
+  {
+    for (auto *job : _jobs)
+      {
+        if (job->numHelpers < job->maxHelpers) return job;
+      }
+    return nullptr;
+  }
+
+  void workerLoop(void)
+  {
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (true)
+      {
+        _workCond.wait(lock, [this](void){return this->findJob() != nullptr;});
+        Job &job = *this->findJob();
+        job.numHelpers++;
+        this->runNextTask(job, lock);
+        job.numHelpers--;
+      }
+  }
+
+  std::mutex _mutex;
+  std::condition_variable _workCond;
+  std::condition_variable _doneCond;
+  std::deque<Job *> _jobs;
+  std::vector<std::thread> _threads;
+};
+
+void SoapySDR::ConverterRegistry::convertParallel(const Handle &handle, const void *srcBuff, void *dstBuff, const size_t numElems, const size_t numThreads)
+{
+  const size_t threads = (numThreads == 0)?std::thread::hardware_concurrency():numThreads;
+  if (threads <= 1) return handle.convert(srcBuff, dstBuff, numElems);
+  convertParallel(handle, srcBuff, dstBuff, numElems, [threads](const std::vector<std::function<void(void)>> &tasks)
+  {
+    ParallelPool::instance().run(tasks, threads);
+  });
+}
+
+void SoapySDR::ConverterRegistry::convertParallel(const Handle &handle, const void *srcBuff, void *dstBuff, const size_t numElems, const Executor &executor)
+{
+  const size_t elemBytes = handle.getSourceSize() + handle.getTargetSize();
+  const size_t chunkElems = std::max<size_t>(PARALLEL_CHUNK_BYTES/std::max<size_t>(elemBytes, 1)/PARALLEL_CHUNK_ALIGN, 1)*PARALLEL_CHUNK_ALIGN;
+  if (numElems <= chunkElems) return handle.convert(srcBuff, dstBuff, numElems);
+
+  //the output chunks of a shrinking conversion overlap the input of other chunks
+  if (srcBuff == dstBuff and handle.getTargetSize() < handle.getSourceSize()) return handle.convert(srcBuff, dstBuff, numElems);
+
+  std::vector<std::function<void(void)>> tasks;
+  tasks.reserve((numElems+chunkElems-1)/chunkElems);
+  for (size_t offset = 0; offset < numElems; offset += chunkElems)
+    {
+      const auto src = reinterpret_cast<const char *>(srcBuff) + offset*handle.getSourceSize();
+      const auto dst = reinterpret_cast<char *>(dstBuff) + offset*handle.getTargetSize();
+      const size_t num = std::min(chunkElems, numElems-offset);
+      tasks.push_back([&handle, src, dst, num](void){handle.convert(src, dst, num);});
+    }
+  executor(tasks);
+}
+
+//! Bytes per intermediate scratch buffer, two of them stay resident in L1/L2
+static const size_t PATH_SCRATCH_BYTES = 16*1024;
+
+void SoapySDR::ConverterRegistry::Handle::convertPath(const void *srcBuff, void *dstBuff, const size_t numElems) const
+{
+  static thread_local std::vector<char> scratch[2];
+  size_t maxHopSize = 1;
+  for (size_t i = 0; i+1 < _hops.size(); i++) maxHopSize = std::max(maxHopSize, _hops[i].targetSize);
+  const size_t blockElems = std::max<size_t>(PATH_SCRATCH_BYTES/maxHopSize, 1);
+  for (auto &buff : scratch) buff.resize(std::max(buff.size(), blockElems*maxHopSize));
+
+  for (size_t offset = 0; offset < numElems; offset += blockElems)
+    {
+      const size_t num = std::min(blockElems, numElems-offset);
+      const void *in = reinterpret_cast<const char *>(srcBuff) + offset*_sourceSize;
+      for (size_t i = 0; i < _hops.size(); i++)
+        {
+          const bool last = (i+1 == _hops.size());
+          void *out = last?(reinterpret_cast<char *>(dstBuff) + offset*_targetSize):scratch[i%2].data();
+          _hops[i].function(in, out, num, (i == _scaledHop)?_scaler:1.0);
+          in = out;
+        }
+    }
+}
@@ -9,12 +9,30 @@
 
 #include <type_traits>
 
+//! A null correction is the identity correction
+static SoapySDR::ConverterRegistry::Correction toCorrection(const SoapySDRConverterCorrection *correction)
+{
+    SoapySDR::ConverterRegistry::Correction out;
+    if (correction == nullptr) return out;
+    out.dcOffset = std::complex<double>(correction->dcOffset[0], correction->dcOffset[1]);
+    for (size_t i = 0; i < 2; i++)
+    {
+        for (size_t j = 0; j < 2; j++) out.matrix[i][j] = correction->matrix[i][j];
+    }
+    return out;
+}
+
 extern "C" {
 
 static_assert(int(SoapySDR::ConverterRegistry::GENERIC) == int(SOAPY_SDR_CONVERTER_GENERIC), "GENERIC");
 static_assert(int(SoapySDR::ConverterRegistry::VECTORIZED) == int(SOAPY_SDR_CONVERTER_VECTORIZED), "VECTORIZED");
 static_assert(int(SoapySDR::ConverterRegistry::CUSTOM) == int(SOAPY_SDR_CONVERTER_CUSTOM), "CUSTOM");
+static_assert(int(SoapySDR::ConverterRegistry::WRAPPING) == int(SOAPY_SDR_CONVERTER_WRAPPING), "WRAPPING");
+static_assert(int(SoapySDR::ConverterRegistry::SATURATING) == int(SOAPY_SDR_CONVERTER_SATURATING), "SATURATING");
+static_assert(int(SoapySDR::ConverterRegistry::STREAMING) == int(SOAPY_SDR_CONVERTER_STREAMING), "STREAMING");
 static_assert(std::is_same<SoapySDR::ConverterRegistry::ConverterFunction, SoapySDRConverterFunction>::value, "ConverterFunction");
+static_assert(std::is_same<SoapySDR::ConverterRegistry::DeinterleaveFunction, SoapySDRConverterDeinterleaveFunction>::value, "DeinterleaveFunction");
+static_assert(std::is_same<SoapySDR::ConverterRegistry::InterleaveFunction, SoapySDRConverterInterleaveFunction>::value, "InterleaveFunction");
 
 char **SoapySDRConverter_listTargetFormats(const char *sourceFormat, size_t *length)
 {
@@ -69,6 +87,13 @@ SoapySDRConverterFunction SoapySDRConverter_getFunctionWithPriority(const char *
     __SOAPY_SDR_C_CATCH_RET(nullptr);
 }
 
+SoapySDRConverterFunction SoapySDRConverter_getFunctionWithVariant(const char *sourceFormat, const char *targetFormat, const SoapySDRConverterFunctionVariant variant)
+{
+    __SOAPY_SDR_C_TRY
+    return SoapySDR::ConverterRegistry::getFunction(sourceFormat, targetFormat, static_cast<SoapySDR::ConverterRegistry::FunctionVariant>(variant));
+    __SOAPY_SDR_C_CATCH_RET(nullptr);
+}
+
 char **SoapySDRConverter_listAvailableSourceFormats(size_t *length)
 {
     *length = 0;
@@ -78,4 +103,80 @@ char **SoapySDRConverter_listAvailableSourceFormats(size_t *length)
     __SOAPY_SDR_C_CATCH_RET(nullptr);
 }
 
+SoapySDRConverterDeinterleaveFunction SoapySDRConverter_getDeinterleaveFunction(const char *sourceFormat, const char *targetFormat)
+{
+    __SOAPY_SDR_C_TRY
+    return SoapySDR::ConverterRegistry::getDeinterleaveFunction(sourceFormat, targetFormat);
+    __SOAPY_SDR_C_CATCH_RET(nullptr);
+}
+
+SoapySDRConverterInterleaveFunction SoapySDRConverter_getInterleaveFunction(const char *sourceFormat, const char *targetFormat)
+{
+    __SOAPY_SDR_C_TRY
+    return SoapySDR::ConverterRegistry::getInterleaveFunction(sourceFormat, targetFormat);
+    __SOAPY_SDR_C_CATCH_RET(nullptr);
+}
+
+SoapySDRConverterHandle *SoapySDRConverter_makeHandle(const char *sourceFormat, const char *targetFormat, const double scaler)
+{
+    __SOAPY_SDR_C_TRY
+    return (SoapySDRConverterHandle *)new SoapySDR::ConverterRegistry::Handle(sourceFormat, targetFormat, scaler);
+    __SOAPY_SDR_C_CATCH_RET(nullptr);
+}
+
+SoapySDRConverterHandle *SoapySDRConverter_makeHandleWithPriority(const char *sourceFormat, const char *targetFormat, const SoapySDRConverterFunctionPriority priority, const double scaler)
+{
+    __SOAPY_SDR_C_TRY
+    return (SoapySDRConverterHandle *)new SoapySDR::ConverterRegistry::Handle(sourceFormat, targetFormat, static_cast<SoapySDR::ConverterRegistry::FunctionPriority>(priority), scaler);
+    __SOAPY_SDR_C_CATCH_RET(nullptr);
+}
+
+SoapySDRConverterHandle *SoapySDRConverter_makeHandleWithVariant(const char *sourceFormat, const char *targetFormat, const SoapySDRConverterFunctionVariant variant, const double scaler)
+{
+    __SOAPY_SDR_C_TRY
+    return (SoapySDRConverterHandle *)new SoapySDR::ConverterRegistry::Handle(sourceFormat, targetFormat, static_cast<SoapySDR::ConverterRegistry::FunctionVariant>(variant), scaler);
+    __SOAPY_SDR_C_CATCH_RET(nullptr);
+}
+
+SoapySDRConverterHandle *SoapySDRConverter_makeHandleWithCorrection(const char *sourceFormat, const char *targetFormat, const SoapySDRConverterCorrection *correction, const double scaler)
+{
+    __SOAPY_SDR_C_TRY
+    return (SoapySDRConverterHandle *)new SoapySDR::ConverterRegistry::Handle(sourceFormat, targetFormat, toCorrection(correction), scaler);
+    __SOAPY_SDR_C_CATCH_RET(nullptr);
+}
+
+void SoapySDRConverter_freeHandle(SoapySDRConverterHandle *handle)
+{
+    delete (SoapySDR::ConverterRegistry::Handle *)handle;
+}
+
+void SoapySDRConverter_setScaler(SoapySDRConverterHandle *handle, const double scaler)
+{
+    ((SoapySDR::ConverterRegistry::Handle *)handle)->setScaler(scaler);
+}
+
+void SoapySDRConverter_setCorrection(SoapySDRConverterHandle *handle, const SoapySDRConverterCorrection *correction)
+{
+    ((SoapySDR::ConverterRegistry::Handle *)handle)->setCorrection(toCorrection(correction));
+}
+
+int SoapySDRConverter_setStreamingThreshold(SoapySDRConverterHandle *handle, const size_t thresholdBytes)
+{
+    __SOAPY_SDR_C_TRY
+    ((SoapySDR::ConverterRegistry::Handle *)handle)->setStreamingThreshold(thresholdBytes);
+    __SOAPY_SDR_C_CATCH
+}
+
+void SoapySDRConverter_convert(const SoapySDRConverterHandle *handle, const void *srcBuff, void *dstBuff, const size_t numElems)
+{
+    ((const SoapySDR::ConverterRegistry::Handle *)handle)->convert(srcBuff, dstBuff, numElems);
+}
+
+int SoapySDRConverter_convertParallel(const SoapySDRConverterHandle *handle, const void *srcBuff, void *dstBuff, const size_t numElems, const size_t numThreads)
+{
+    __SOAPY_SDR_C_TRY
+    SoapySDR::ConverterRegistry::convertParallel(*(const SoapySDR::ConverterRegistry::Handle *)handle, srcBuff, dstBuff, numElems, numThreads);
+    __SOAPY_SDR_C_CATCH
+}
+
 }
@@ -0,0 +1,142 @@
+// Copyright (c) 2021-2021 Josh Blum
+// SPDX-License-Identifier: BSL-1.0
+
+#include <SoapySDR/ConvertingStream.hpp>
+#include <SoapySDR/Formats.hpp>
+#include <algorithm> //min
+#include <cmath> //exp2, log2
+
+//! The scaler which maps the native full scale to the full scale of the native format
+static double nativeScaler(const std::string &nativeFormat, const double nativeFullScale)
+{
+    if (not (nativeFullScale > 0.0)) return 1.0;
+
+    //drivers report the largest value, such as 2047 or 2048 for 12 bits
+    const double fullScale = std::exp2(std::ceil(std::log2(nativeFullScale)));
+    const auto native = SoapySDR::formatToDescriptor(nativeFormat);
+    const double formatFullScale = native.isFloat?1.0:std::exp2(double(native.bitDepth)-1);
+    return formatFullScale/fullScale;
+}
+
+SoapySDR::ConvertingStream::ConvertingStream(
+    Device *device,
+    const int direction,
+    const std::string &format,
+    const std::vector<size_t> &channels,
+    const Kwargs &args):
+    _device(device),
+    _format(format),
+    _stream(nullptr),
+    _mtu(0)
+{
+    double nativeFullScale(0.0);
+    _nativeFormat = _device->getNativeStreamFormat(direction, channels.empty()?0:channels.front(), nativeFullScale);
+
+    //bind the converter first, it throws when there is no conversion
+    if (this->isConverting())
+    {
+        const double scaler = nativeScaler(_nativeFormat, nativeFullScale);
+        if (direction == SOAPY_SDR_RX) _converter = ConverterRegistry::Handle(_nativeFormat, _format, scaler);
+        else _converter = ConverterRegistry::Handle(_format, _nativeFormat, 1.0/scaler);
+    }
+
+    _stream = _device->setupStream(direction, _nativeFormat, channels, args);
+    if (not this->isConverting()) return;
+
+    try
+    {
+        _mtu = _device->getStreamMTU(_stream);
+        const size_t numChans = channels.empty()?1:channels.size();
+        const size_t chanBytes = _mtu*SoapySDR::formatToSize(_nativeFormat);
+        _scratch.resize(numChans*chanBytes);
+        for (size_t ch = 0; ch < numChans; ch++) _scratchBuffs.push_back(_scratch.data()+ch*chanBytes);
+    }
+    catch (...)
+    {
+        _device->closeStream(_stream);
+        throw;
+    }
+}
+
+SoapySDR::ConvertingStream::~ConvertingStream(void)
+{
+    _device->closeStream(_stream);
+}
+
+SoapySDR::Stream *SoapySDR::ConvertingStream::getNativeStream(void) const
+{
+    return _stream;
+}
+
+const std::string &SoapySDR::ConvertingStream::getFormat(void) const
+{
+    return _format;
+}
+
+const std::string &SoapySDR::ConvertingStream::getNativeFormat(void) const
+{
+    return _nativeFormat;
+}
+
+bool SoapySDR::ConvertingStream::isConverting(void) const
+{
+    return _format != _nativeFormat;
+}
+
+size_t SoapySDR::ConvertingStream::getStreamMTU(void) const
+{
+    return _device->getStreamMTU(_stream);
+}
+
+int SoapySDR::ConvertingStream::activateStream(const int flags, const long long timeNs, const size_t numElems)
+{
+    return _device->activateStream(_stream, flags, timeNs, numElems);
+}
+
+int SoapySDR::ConvertingStream::deactivateStream(const int flags, const long long timeNs)
+{
+    return _device->deactivateStream(_stream, flags, timeNs);
+}
+
+int SoapySDR::ConvertingStream::readStream(
+    void * const *buffs,
+    const size_t numElems,
+    int &flags,
+    long long &timeNs,
+    const long timeoutUs)
+{
+    if (not this->isConverting()) return _device->readStream(_stream, buffs, numElems, flags, timeNs, timeoutUs);
+
+    const int ret = _device->readStream(_stream, _scratchBuffs.data(), std::min(numElems, _mtu), flags, timeNs, timeoutUs);
+    if (ret <= 0) return ret;
+    for (size_t ch = 0; ch < _scratchBuffs.size(); ch++)
+    {
+        _converter.convert(_scratchBuffs[ch], buffs[ch], size_t(ret));
+    }
+    return ret;
+}
+
+int SoapySDR::ConvertingStream::writeStream(
+    const void * const *buffs,
+    const size_t numElems,
+    int &flags,
+    const long long timeNs,
+    const long timeoutUs)
+{
+    if (not this->isConverting()) return _device->writeStream(_stream, buffs, numElems, flags, timeNs, timeoutUs);
+
+    //the end of burst belongs to the last element, which is not written in this call
+    const size_t numWrite = std::min(numElems, _mtu);
+    if (numWrite < numElems) flags &= ~SOAPY_SDR_END_BURST;
+
+    for (size_t ch = 0; ch < _scratchBuffs.size(); ch++)
+    {
+        _converter.convert(buffs[ch], _scratchBuffs[ch], numWrite);
+    }
+    return _device->writeStream(_stream, _scratchBuffs.data(), numWrite, flags, timeNs, timeoutUs);
+}
+
+int SoapySDR::ConvertingStream::readStreamStatus(size_t &chanMask, int &flags, long long &timeNs, const long timeoutUs)
+{
+    return _device->readStreamStatus(_stream, chanMask, flags, timeNs, timeoutUs);
+}
@@ -8,639 +8,642 @@
 #include <SoapySDR/ConverterRegistry.hpp>
 #include <SoapySDR/Formats.hpp>
 #include <cstring> //memcpy
+#include <algorithm> //min
+#include <limits>
+#include <cmath> //sqrt
+#include <type_traits> //integral_constant
 
 // ********************************
-// Real Soapy Formats
+// Lookup Tables
 
-// Copy Converters
-
-// F32 <> F32
-static void genericF32toF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+/*!
+ * A lookup table maps every 8-bit source value to its scaled output.
+ * The most recently used tables are cached per thread and per scaler,
+ * so the converters access them without any synchronization.
+ */
+template <typename Type>
+struct LookupTable
 {
-  const size_t elemDepth = 1;
+  double scaler;
+  Type values[256];
+};
 
-  if (scaler == 1.0)
-    {
-      const size_t sampleSize = sizeof(float);
-      std::memcpy(dstBuff, srcBuff, numElems*elemDepth*sampleSize);
-    }
-  else
-    {
-      auto *src = (float*)srcBuff;
-      auto *dst = (float*)dstBuff;
-      for (size_t i = 0; i < numElems*elemDepth; i++)
-        {
-          dst[i] = float(src[i]) * scaler;
-        }
-    }
-}
+// Building a table costs about as much as converting 256 values,
+// shorter buffers use the arithmetic path unless a table is cached.
+static const size_t LOOKUP_TABLE_MIN_VALUES = 256;
 
-// S32 <> S32
-static void genericS32toS32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+template <typename Type, Type (*convert)(const uint8_t)>
+static const Type *getLookupTable(const size_t numValues, const double scaler)
 {
-  const size_t elemDepth = 1;
+  static const size_t cacheSize = 4;
+  static thread_local LookupTable<Type> cache[cacheSize];
+  static thread_local size_t numBuilt = 0;
 
-  if (scaler == 1.0)
+  for (size_t i = 0; i < std::min(numBuilt, cacheSize); i++)
     {
-      const size_t sampleSize = sizeof(int32_t);
-      std::memcpy(dstBuff, srcBuff, numElems*elemDepth*sampleSize);
-    }
-  else
-    {
-      auto *src = (int32_t*)srcBuff;
-      auto *dst = (int32_t*)dstBuff;
-      for (size_t i = 0; i < numElems*elemDepth; i++)
-        {
-          dst[i] = int32_t(src[i]) * scaler;
-        }
+      if (cache[i].scaler == scaler) return cache[i].values;
     }
-}
 
-// S16 <> S16
-static void genericS16toS16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
-{
-  const size_t elemDepth = 1;
+  if (numValues < LOOKUP_TABLE_MIN_VALUES) return nullptr;
 
-  if (scaler == 1.0)
-    {
-      const size_t sampleSize = sizeof(int16_t);
-      std::memcpy(dstBuff, srcBuff, numElems*elemDepth*sampleSize);
-    }
-  else
+  auto &entry = cache[(numBuilt++) % cacheSize];
+  entry.scaler = scaler;
+  for (size_t i = 0; i < 256; i++)
     {
-      auto *src = (int16_t*)srcBuff;
-      auto *dst = (int16_t*)dstBuff;
-      for (size_t i = 0; i < numElems*elemDepth; i++)
-        {
-          dst[i] = int16_t(src[i]) * scaler;
-        }
+      entry.values[i] = convert(uint8_t(i)) * scaler;
     }
+  return entry.values;
 }
 
-// S8 <> S8
-static void genericS8toS8(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
-{
-  const size_t elemDepth = 1;
+// ********************************
+// Format Traits
+//
+// Each real format is described by its traits, and the converters
+// for every pair of real formats and of their complex counterparts
+// are generated from the traits of the source and the target.
 
-  if (scaler == 1.0)
-    {
-      const size_t sampleSize = sizeof(int8_t);
-      std::memcpy(dstBuff, srcBuff, numElems*elemDepth*sampleSize);
-    }
-  else
-    {
-      auto *src = (int8_t*)srcBuff;
-      auto *dst = (int8_t*)dstBuff;
-      for (size_t i = 0; i < numElems*elemDepth; i++)
-        {
-          dst[i] = int8_t(src[i]) * scaler;
-        }
-    }
-}
+/*!
+ * Type is the type of the stored values, and Value is the type that
+ * is scaled: the float itself, or the two's complement integer.
+ * Integer formats store the value plus the zero offset (offset binary),
+ * and the value divided by the full scale is the normalized float.
+ * Float formats have a full scale of zero.
+ */
+template <typename TypeT, typename ValueT, uint32_t fullScaleT, uint32_t zeroOffsetT>
+struct FormatTraits
+{
+  typedef TypeT Type;
+  typedef ValueT Value;
+  static const bool isFloat = (fullScaleT == 0);
+  static const uint32_t fullScale = fullScaleT;
+
+  static Value toValue(const Type from)
+  {
+    return Value(from - Type(zeroOffsetT));
+  }
+
+  static Type fromValue(const Value from)
+  {
+    return Type(Type(from) + Type(zeroOffsetT));
+  }
+};
+
+#define DECLARE_FORMAT_TRAITS(name, type, value, fullScale, zeroOffset) \
+  struct Format ## name : FormatTraits<type, value, fullScale, zeroOffset> \
+  { \
+    static const char *real(void) { return SOAPY_SDR_ ## name; } \
+    static const char *complex(void) { return SOAPY_SDR_C ## name; } \
+  };
+
+DECLARE_FORMAT_TRAITS(F64, double, double, 0, 0)
+DECLARE_FORMAT_TRAITS(F32, float, float, 0, 0)
+DECLARE_FORMAT_TRAITS(S32, int32_t, int32_t, SoapySDR::S32_FULL_SCALE, 0)
+DECLARE_FORMAT_TRAITS(U32, uint32_t, int32_t, SoapySDR::S32_FULL_SCALE, SoapySDR::U32_ZERO_OFFSET)
+DECLARE_FORMAT_TRAITS(S16, int16_t, int16_t, SoapySDR::S16_FULL_SCALE, 0)
+DECLARE_FORMAT_TRAITS(U16, uint16_t, int16_t, SoapySDR::S16_FULL_SCALE, SoapySDR::U16_ZERO_OFFSET)
+DECLARE_FORMAT_TRAITS(S8, int8_t, int8_t, SoapySDR::S8_FULL_SCALE, 0)
+DECLARE_FORMAT_TRAITS(U8, uint8_t, int8_t, SoapySDR::S8_FULL_SCALE, SoapySDR::U8_ZERO_OFFSET)
+
+#undef DECLARE_FORMAT_TRAITS
 
-// Type Converters
+// ********************************
+// Generated Converters
 
-// F32 <> S16
-static void genericF32toS16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
-{
-  const size_t elemDepth = 1;
+// The kind of conversion is selected from the traits at compile time:
+// 0 for float to float, 1 for integer to float, 2 for float to integer,
+// 3 for integer to integer (see ConverterPrimitives.hpp).
+template <typename SrcFormat, typename DstFormat>
+struct ConversionKind : std::integral_constant<int, (SrcFormat::isFloat?0:1) + (DstFormat::isFloat?0:2)> {};
 
-  auto *src = (float*)srcBuff;
-  auto *dst = (int16_t*)dstBuff;
-  for (size_t i = 0; i < numElems*elemDepth; i++)
-    {
-      dst[i] = SoapySDR::F32toS16(src[i] * scaler);
-    }
+// Integer values are MSB aligned, so a change of width is a shift.
+template <typename DstValue, typename SrcValue>
+static DstValue resizeValue(const SrcValue from, std::integral_constant<int, -1>)
+{
+  return DstValue(from >> (8*(sizeof(SrcValue)-sizeof(DstValue))));
 }
 
-static void genericS16toF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+template <typename DstValue, typename SrcValue>
+static DstValue resizeValue(const SrcValue from, std::integral_constant<int, 0>)
 {
-  const size_t elemDepth = 1;
-
-  auto *src = (int16_t*)srcBuff;
-  auto *dst = (float*)dstBuff;
-  for (size_t i = 0; i < numElems*elemDepth; i++)
-    {
-      dst[i] = SoapySDR::S16toF32(src[i]) * scaler;
-    }
+  return DstValue(from);
 }
 
-// F32 <> U16
-static void genericF32toU16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+template <typename DstValue, typename SrcValue>
+static DstValue resizeValue(const SrcValue from, std::integral_constant<int, 1>)
 {
-  const size_t elemDepth = 1;
-
-  auto *src = (float*)srcBuff;
-  auto *dst = (uint16_t*)dstBuff;
-  for (size_t i = 0; i < numElems*elemDepth; i++)
-    {
-      dst[i] = SoapySDR::F32toU16(src[i] * scaler);
-    }
+  return DstValue(int32_t(from) << (8*(sizeof(DstValue)-sizeof(SrcValue))));
 }
 
-static void genericU16toF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+template <typename DstValue, typename SrcValue>
+static DstValue resizeValue(const SrcValue from)
 {
-  const size_t elemDepth = 1;
-
-  auto *src = (uint16_t*)srcBuff;
-  auto *dst = (float*)dstBuff;
-  for (size_t i = 0; i < numElems*elemDepth; i++)
-    {
-      dst[i] = SoapySDR::U16toF32(src[i]) * scaler;
-    }
+  return resizeValue<DstValue>(from, std::integral_constant<int,
+    (sizeof(DstValue) < sizeof(SrcValue))?-1:((sizeof(DstValue) > sizeof(SrcValue))?1:0)>());
 }
 
-// F32 <> S8
-static void genericF32toS8(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+// The scaler multiplies in double precision and
+// the unit scaler skips the multiply at compile time.
+template <typename SrcFormat, typename DstFormat, bool unitScaler>
+static typename DstFormat::Type convertValue(const typename SrcFormat::Type from, const double scaler, std::integral_constant<int, 0>)
 {
-  const size_t elemDepth = 1;
+  typedef typename DstFormat::Type DstType;
+  return unitScaler?DstType(from):DstType(from * scaler);
+}
 
-  auto *src = (float*)srcBuff;
-  auto *dst = (int8_t*)dstBuff;
-  for (size_t i = 0; i < numElems*elemDepth; i++)
-    {
-      dst[i] = SoapySDR::F32toS8(src[i] * scaler);
-    }
+// The float value is computed in the precision of the target,
+// and the scaler is applied to the float value.
+template <typename SrcFormat, typename DstFormat, bool unitScaler>
+static typename DstFormat::Type convertValue(const typename SrcFormat::Type from, const double scaler, std::integral_constant<int, 1>)
+{
+  typedef typename DstFormat::Type DstType;
+  const DstType value = DstType(SrcFormat::toValue(from)) / SrcFormat::fullScale;
+  return unitScaler?value:DstType(value * scaler);
 }
 
-static void genericS8toF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+// The scaler is applied to the float value,
+// which is truncated and clamped to the target integer.
+template <typename SrcFormat, typename DstFormat, bool unitScaler>
+static typename DstFormat::Type convertValue(const typename SrcFormat::Type from, const double scaler, std::integral_constant<int, 2>)
 {
-  const size_t elemDepth = 1;
+  typedef typename SrcFormat::Type SrcType;
+  const SrcType value = unitScaler?from:SrcType(from * scaler);
+  return DstFormat::fromValue(SoapySDR::FloatToInt<typename DstFormat::Value>(value * DstFormat::fullScale));
+}
 
-  auto *src = (int8_t*)srcBuff;
-  auto *dst = (float*)dstBuff;
-  for (size_t i = 0; i < numElems*elemDepth; i++)
-    {
-      dst[i] = SoapySDR::S8toF32(src[i]) * scaler;
-    }
+// The scaler is applied to the two's complement value of the wider format,
+// before a narrowing conversion and after a widening conversion.
+template <typename SrcFormat, typename DstFormat, bool unitScaler>
+static typename DstFormat::Type convertValue(const typename SrcFormat::Type from, const double scaler, std::integral_constant<int, 3>)
+{
+  typedef typename SrcFormat::Value SrcValue;
+  typedef typename DstFormat::Value DstValue;
+  const SrcValue value = SrcFormat::toValue(from);
+  if (unitScaler) return DstFormat::fromValue(resizeValue<DstValue>(value));
+  if (sizeof(DstValue) > sizeof(SrcValue)) return DstFormat::fromValue(DstValue(resizeValue<DstValue>(value) * scaler));
+  return DstFormat::fromValue(resizeValue<DstValue>(SrcValue(value * scaler)));
 }
 
-// F32 <> U8
-static void genericF32toU8(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+template <typename SrcFormat, typename DstFormat, bool unitScaler>
+static typename DstFormat::Type convertValue(const typename SrcFormat::Type from, const double scaler)
 {
-  const size_t elemDepth = 1;
+  return convertValue<SrcFormat, DstFormat, unitScaler>(from, scaler, ConversionKind<SrcFormat, DstFormat>());
+}
 
-  auto *src = (float*)srcBuff;
-  auto *dst = (uint8_t*)dstBuff;
-  for (size_t i = 0; i < numElems*elemDepth; i++)
-    {
-      dst[i] = SoapySDR::F32toU8(src[i] * scaler);
-    }
+template <typename SrcFormat, typename DstFormat>
+static typename DstFormat::Type lookupValue(const uint8_t from)
+{
+  return convertValue<SrcFormat, DstFormat, true>(typename SrcFormat::Type(from), 1.0);
 }
 
-static void genericU8toF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+template <typename SrcFormat, typename DstFormat, bool unitScaler>
+static void genericConvertValues(const void *srcBuff, void *dstBuff, const size_t numValues, const double scaler)
 {
-  const size_t elemDepth = 1;
+  if (unitScaler and std::is_same<SrcFormat, DstFormat>::value)
+    {
+      const size_t sampleSize = sizeof(typename SrcFormat::Type);
+      if (srcBuff != dstBuff) std::memcpy(dstBuff, srcBuff, numValues*sampleSize);
+      return;
+    }
 
-  auto *src = (uint8_t*)srcBuff;
-  auto *dst = (float*)dstBuff;
-  for (size_t i = 0; i < numElems*elemDepth; i++)
+  auto *src = (const typename SrcFormat::Type*)srcBuff;
+  auto *dst = (typename DstFormat::Type*)dstBuff;
+  for (size_t i = 0; i < numValues; i++)
     {
-      dst[i] = SoapySDR::U8toF32(src[i]) * scaler;
+      dst[i] = convertValue<SrcFormat, DstFormat, unitScaler>(src[i], scaler);
     }
 }
 
-// S16 <> U16
-static void genericS16toU16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+// 8-bit sources to float targets read the values from a lookup table
+template <typename SrcFormat, typename DstFormat>
+static bool lookupConvertValues(const void *srcBuff, void *dstBuff, const size_t numValues, const double scaler, std::true_type)
 {
-  const size_t elemDepth = 1;
+  typedef typename DstFormat::Type DstType;
+  const auto *table = getLookupTable<DstType, &lookupValue<SrcFormat, DstFormat>>(numValues, scaler);
+  if (table == nullptr) return false;
 
-  auto *src = (int16_t*)srcBuff;
-  auto *dst = (uint16_t*)dstBuff;
-  for (size_t i = 0; i < numElems*elemDepth; i++)
+  auto *src = (const uint8_t*)srcBuff;
+  auto *dst = (DstType*)dstBuff;
+  for (size_t i = 0; i < numValues; i++)
     {
-      dst[i] = SoapySDR::S16toU16(src[i] * scaler);
+      dst[i] = table[src[i]];
     }
+  return true;
 }
 
-static void genericU16toS16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+template <typename SrcFormat, typename DstFormat>
+static bool lookupConvertValues(const void *, void *, const size_t, const double, std::false_type)
 {
-  const size_t elemDepth = 1;
-
-  auto *src = (uint16_t*)srcBuff;
-  auto *dst = (int16_t*)dstBuff;
-  for (size_t i = 0; i < numElems*elemDepth; i++)
-    {
-      dst[i] = SoapySDR::U16toS16(src[i]) * scaler;
-    }
+  return false;
 }
 
-// S16 <> S8
-static void genericS16toS8(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+// elemDepth is the number of scalar values per element, 2 for complex formats
+template <typename SrcFormat, typename DstFormat, size_t elemDepth>
+static void genericConvert(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
 {
-  const size_t elemDepth = 1;
+  const size_t numValues = numElems*elemDepth;
+  const bool useTable = sizeof(typename SrcFormat::Type) == 1 and DstFormat::isFloat;
+  if (lookupConvertValues<SrcFormat, DstFormat>(srcBuff, dstBuff, numValues, scaler, std::integral_constant<bool, useTable>())) return;
 
-  auto *src = (int16_t*)srcBuff;
-  auto *dst = (int8_t*)dstBuff;
-  for (size_t i = 0; i < numElems*elemDepth; i++)
-    {
-      dst[i] = SoapySDR::S16toS8(src[i] * scaler);
-    }
+  if (scaler == 1.0) genericConvertValues<SrcFormat, DstFormat, true>(srcBuff, dstBuff, numValues, scaler);
+  else genericConvertValues<SrcFormat, DstFormat, false>(srcBuff, dstBuff, numValues, scaler);
 }
 
-static void genericS8toS16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+/*!
+ * Register the real and the complex converter from the source to each
+ * target format, and then from each of the formats to every format.
+ * The registrations are function local statics of each instantiation,
+ * so call registerAll() once rather than checking each guard per call.
+ */
+template <typename... Formats>
+struct FormatMatrix
+{
+  template <typename SrcFormat, typename DstFormat>
+  static int registerPair(void)
+  {
+    static SoapySDR::ConverterRegistry registerReal(SrcFormat::real(), DstFormat::real(), SoapySDR::ConverterRegistry::GENERIC, &genericConvert<SrcFormat, DstFormat, 1>);
+    static SoapySDR::ConverterRegistry registerComplex(SrcFormat::complex(), DstFormat::complex(), SoapySDR::ConverterRegistry::GENERIC, &genericConvert<SrcFormat, DstFormat, 2>);
+    return 0;
+  }
+
+  template <typename SrcFormat>
+  static int registerSource(void)
+  {
+    const int registered[] = {registerPair<SrcFormat, Formats>()...};
+    (void)registered;
+    return 0;
+  }
+
+  static bool registerAll(void)
+  {
+    const int registered[] = {registerSource<Formats>()...};
+    (void)registered;
+    return true;
+  }
+};
+
+// ********************************
+// Packed Converters
+
+// CS12 <> CS16
+static void genericCS12toCS16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
 {
-  const size_t elemDepth = 1;
+  const size_t elemDepth = 2;
 
-  auto *src = (int8_t*)srcBuff;
+  auto *src = (uint8_t*)srcBuff;
   auto *dst = (int16_t*)dstBuff;
-  for (size_t i = 0; i < numElems*elemDepth; i++)
+  for (size_t i = 0; i < numElems; i++)
     {
-      dst[i] = SoapySDR::S8toS16(src[i]) * scaler;
+      int16_t tmp[elemDepth];
+      SoapySDR::CS12toCS16(src+i*3, tmp);
+      dst[i*elemDepth+0] = tmp[0] * scaler;
+      dst[i*elemDepth+1] = tmp[1] * scaler;
     }
 }
 
-// S16 <> U8
-static void genericS16toU8(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+static void genericCS16toCS12(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
 {
-  const size_t elemDepth = 1;
+  const size_t elemDepth = 2;
 
   auto *src = (int16_t*)srcBuff;
   auto *dst = (uint8_t*)dstBuff;
-  for (size_t i = 0; i < numElems*elemDepth; i++)
+  for (size_t i = 0; i < numElems; i++)
     {
-      dst[i] = SoapySDR::S16toU8(src[i] * scaler);
+      const int16_t tmp[elemDepth] = {int16_t(src[i*elemDepth+0] * scaler), int16_t(src[i*elemDepth+1] * scaler)};
+      SoapySDR::CS16toCS12(tmp, dst+i*3);
     }
 }
 
-static void genericU8toS16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+// CS12 <> CF32
+static void genericCS12toCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
 {
-  const size_t elemDepth = 1;
+  const size_t elemDepth = 2;
 
   auto *src = (uint8_t*)srcBuff;
-  auto *dst = (int16_t*)dstBuff;
-  for (size_t i = 0; i < numElems*elemDepth; i++)
+  auto *dst = (float*)dstBuff;
+  for (size_t i = 0; i < numElems; i++)
     {
-      dst[i] = SoapySDR::U8toS16(src[i]) * scaler;
+      int16_t tmp[elemDepth];
+      SoapySDR::CS12toCS16(src+i*3, tmp);
+      dst[i*elemDepth+0] = SoapySDR::S16toF32(tmp[0]) * scaler;
+      dst[i*elemDepth+1] = SoapySDR::S16toF32(tmp[1]) * scaler;
     }
 }
 
-// U16 <> S8
-static void genericU16toS8(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+static void genericCF32toCS12(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
 {
-  const size_t elemDepth = 1;
+  const size_t elemDepth = 2;
 
-  auto *src = (uint16_t*)srcBuff;
-  auto *dst = (int8_t*)dstBuff;
-  for (size_t i = 0; i < numElems*elemDepth; i++)
+  auto *src = (float*)srcBuff;
+  auto *dst = (uint8_t*)dstBuff;
+  for (size_t i = 0; i < numElems; i++)
     {
-      dst[i] = SoapySDR::U16toS8(src[i] * scaler);
+      const int16_t tmp[elemDepth] = {SoapySDR::F32toS16(src[i*elemDepth+0] * scaler), SoapySDR::F32toS16(src[i*elemDepth+1] * scaler)};
+      SoapySDR::CS16toCS12(tmp, dst+i*3);
     }
 }
 
-static void genericS8toU16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+// CS4 <> CS8
+static void genericCS4toCS8(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
 {
-  const size_t elemDepth = 1;
+  const size_t elemDepth = 2;
 
-  auto *src = (int8_t*)srcBuff;
-  auto *dst = (uint16_t*)dstBuff;
-  for (size_t i = 0; i < numElems*elemDepth; i++)
+  auto *src = (uint8_t*)srcBuff;
+  auto *dst = (int8_t*)dstBuff;
+  for (size_t i = 0; i < numElems; i++)
     {
-      dst[i] = SoapySDR::S8toU16(src[i]) * scaler;
+      int8_t tmp[elemDepth];
+      SoapySDR::CS4toCS8(src[i], tmp);
+      dst[i*elemDepth+0] = tmp[0] * scaler;
+      dst[i*elemDepth+1] = tmp[1] * scaler;
     }
 }
 
-// S8 <> U8
-static void genericS8toU8(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+static void genericCS8toCS4(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
 {
-  const size_t elemDepth = 1;
+  const size_t elemDepth = 2;
 
   auto *src = (int8_t*)srcBuff;
   auto *dst = (uint8_t*)dstBuff;
-  for (size_t i = 0; i < numElems*elemDepth; i++)
+  for (size_t i = 0; i < numElems; i++)
     {
-      dst[i] = SoapySDR::S8toU8(src[i] * scaler);
+      const int8_t tmp[elemDepth] = {int8_t(src[i*elemDepth+0] * scaler), int8_t(src[i*elemDepth+1] * scaler)};
+      dst[i] = SoapySDR::CS8toCS4(tmp);
     }
 }
 
-static void genericU8toS8(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+// CS4 <> CF32
+static void genericCS4toCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
 {
-  const size_t elemDepth = 1;
+  const size_t elemDepth = 2;
 
   auto *src = (uint8_t*)srcBuff;
-  auto *dst = (int8_t*)dstBuff;
-  for (size_t i = 0; i < numElems*elemDepth; i++)
+  auto *dst = (float*)dstBuff;
+  for (size_t i = 0; i < numElems; i++)
     {
-      dst[i] = SoapySDR::U8toS8(src[i]) * scaler;
+      int8_t tmp[elemDepth];
+      SoapySDR::CS4toCS8(src[i], tmp);
+      dst[i*elemDepth+0] = SoapySDR::S8toF32(tmp[0]) * scaler;
+      dst[i*elemDepth+1] = SoapySDR::S8toF32(tmp[1]) * scaler;
     }
 }
 
-// ********************************
-// Complex Data Types
-
-// Copy Converters
-
-// CF32 <> CF32
-static void genericCF32toCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+static void genericCF32toCS4(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
 {
   const size_t elemDepth = 2;
 
-  if (scaler == 1.0)
-    {
-      const size_t sampleSize = sizeof(float);
-      std::memcpy(dstBuff, srcBuff, numElems*elemDepth*sampleSize);
-    }
-  else
+  auto *src = (float*)srcBuff;
+  auto *dst = (uint8_t*)dstBuff;
+  for (size_t i = 0; i < numElems; i++)
     {
-      auto *src = (float*)srcBuff;
-      auto *dst = (float*)dstBuff;
-      for (size_t i = 0; i < numElems*elemDepth; i++)
-        {
-          dst[i] = float(src[i]) * scaler;
-        }
+      const int8_t tmp[elemDepth] = {SoapySDR::F32toS8(src[i*elemDepth+0] * scaler), SoapySDR::F32toS8(src[i*elemDepth+1] * scaler)};
+      dst[i] = SoapySDR::CS8toCS4(tmp);
     }
 }
 
-// CS32 <> CS32
-static void genericCS32toCS32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+// ********************************
+// Statistics Converters
+//
+// The peak, the power, and the clip count are accumulated from the
+// samples while they are converted, so monitoring every buffer
+// does not need a second pass over the output.
+
+template <typename SrcType, float (*convert)(SrcType)>
+static void genericStatisticsToCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler, SoapySDR::ConverterRegistry::Statistics &stats)
 {
   const size_t elemDepth = 2;
+  const SrcType minValue = std::numeric_limits<SrcType>::min();
+  const SrcType maxValue = std::numeric_limits<SrcType>::max();
 
-  if (scaler == 1.0)
-    {
-      const size_t sampleSize = sizeof(int32_t);
-      std::memcpy(dstBuff, srcBuff, numElems*elemDepth*sampleSize);
-    }
-  else
+  double peakPower = 0.0, sumPower = 0.0;
+  size_t clipCount = 0;
+  auto *src = (SrcType*)srcBuff;
+  auto *dst = (float*)dstBuff;
+  for (size_t i = 0; i < numElems; i++)
     {
-      auto *src = (int32_t*)srcBuff;
-      auto *dst = (int32_t*)dstBuff;
-      for (size_t i = 0; i < numElems*elemDepth; i++)
-        {
-          dst[i] = int32_t(src[i]) * scaler;
-        }
+      const SrcType xI = src[i*elemDepth+0];
+      const SrcType xQ = src[i*elemDepth+1];
+      const float yI = convert(xI) * scaler;
+      const float yQ = convert(xQ) * scaler;
+      dst[i*elemDepth+0] = yI;
+      dst[i*elemDepth+1] = yQ;
+
+      const double power = double(yI)*yI + double(yQ)*yQ;
+      peakPower = std::max(peakPower, power);
+      sumPower += power;
+      if (xI == minValue or xI == maxValue or xQ == minValue or xQ == maxValue) clipCount++;
     }
+
+  stats.peak = std::sqrt(peakPower);
+  stats.meanPower = (numElems == 0)?0.0:sumPower/numElems;
+  stats.clipCount = clipCount;
 }
 
-// CS16 <> CS16
-static void genericCS16toCS16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
-{
-  const size_t elemDepth = 2;
+// ********************************
+// Big Endian Converters
+//
+// The big endian formats are swapped to or from host order
+// in the same pass as the conversion and the scaler.
 
+template <typename Type, Type (*swap)(Type), size_t elemDepth, bool toBigEndian>
+static void genericSwap(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  auto *src = (Type*)srcBuff;
+  auto *dst = (Type*)dstBuff;
   if (scaler == 1.0)
     {
-      const size_t sampleSize = sizeof(int16_t);
-      std::memcpy(dstBuff, srcBuff, numElems*elemDepth*sampleSize);
-    }
-  else
-    {
-      auto *src = (int16_t*)srcBuff;
-      auto *dst = (int16_t*)dstBuff;
       for (size_t i = 0; i < numElems*elemDepth; i++)
         {
-          dst[i] = int16_t(src[i]) * scaler;
+          dst[i] = swap(src[i]);
         }
     }
-}
-
-// CS8 <> CS8
-static void genericCS8toCS8(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
-{
-  const size_t elemDepth = 2;
-
-  if (scaler == 1.0)
+  else if (toBigEndian)
     {
-      const size_t sampleSize = sizeof(int8_t);
-      std::memcpy(dstBuff, srcBuff, numElems*elemDepth*sampleSize);
+      for (size_t i = 0; i < numElems*elemDepth; i++)
+        {
+          dst[i] = swap(Type(src[i] * scaler));
+        }
     }
   else
     {
-      auto *src = (int8_t*)srcBuff;
-      auto *dst = (int8_t*)dstBuff;
       for (size_t i = 0; i < numElems*elemDepth; i++)
         {
-          dst[i] = int8_t(src[i]) * scaler;
+          dst[i] = Type(swap(src[i]) * scaler);
         }
     }
 }
 
-// Type Converters
-
-// CF32 <> CS16
-static void genericCF32toCS16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
-{
-  const size_t elemDepth = 2;
-
-  auto *src = (float*)srcBuff;
-  auto *dst = (int16_t*)dstBuff;
-  for (size_t i = 0; i < numElems*elemDepth; i++)
-    {
-      dst[i] = SoapySDR::F32toS16(src[i] * scaler);
-    }
-}
-
-static void genericCS16toCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+template <typename IntType, typename FloatType, IntType (*swap)(IntType), FloatType (*convert)(IntType), size_t elemDepth>
+static void genericSwapToFloat(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
 {
-  const size_t elemDepth = 2;
-
-  auto *src = (int16_t*)srcBuff;
-  auto *dst = (float*)dstBuff;
+  auto *src = (IntType*)srcBuff;
+  auto *dst = (FloatType*)dstBuff;
   for (size_t i = 0; i < numElems*elemDepth; i++)
     {
-      dst[i] = SoapySDR::S16toF32(src[i]) * scaler;
+      dst[i] = convert(swap(src[i])) * scaler;
     }
 }
 
-// CF32 <> CU16
-static void genericCF32toCU16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+template <typename FloatType, typename IntType, IntType (*convert)(FloatType), IntType (*swap)(IntType), size_t elemDepth>
+static void genericFloatToSwap(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
 {
-  const size_t elemDepth = 2;
-
-  auto *src = (float*)srcBuff;
-  auto *dst = (uint16_t*)dstBuff;
+  auto *src = (FloatType*)srcBuff;
+  auto *dst = (IntType*)dstBuff;
   for (size_t i = 0; i < numElems*elemDepth; i++)
     {
-      dst[i] = SoapySDR::F32toU16(src[i] * scaler);
+      dst[i] = swap(convert(src[i] * scaler));
     }
 }
 
-static void genericCU16toCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
-{
-  const size_t elemDepth = 2;
-
-  auto *src = (uint16_t*)srcBuff;
-  auto *dst = (float*)dstBuff;
-  for (size_t i = 0; i < numElems*elemDepth; i++)
-    {
-      dst[i] = SoapySDR::U16toF32(src[i]) * scaler;
-    }
-}
+// ********************************
+// Saturating Converters
+//
+// The SATURATING variant of the float to integer converters
+// rounds to nearest and clamps out of range values,
+// where the default converters truncate toward zero and clamp.
 
-// CF32 <> CS8
-static void genericCF32toCS8(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+template <typename DstType, DstType (*convert)(float), size_t elemDepth>
+static void genericSaturating(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
 {
-  const size_t elemDepth = 2;
-
   auto *src = (float*)srcBuff;
-  auto *dst = (int8_t*)dstBuff;
-  for (size_t i = 0; i < numElems*elemDepth; i++)
-    {
-      dst[i] = SoapySDR::F32toS8(src[i] * scaler);
-    }
-}
-
-static void genericCS8toCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
-{
-  const size_t elemDepth = 2;
-
-  auto *src = (int8_t*)srcBuff;
-  auto *dst = (float*)dstBuff;
+  auto *dst = (DstType*)dstBuff;
   for (size_t i = 0; i < numElems*elemDepth; i++)
     {
-      dst[i] = SoapySDR::S8toF32(src[i]) * scaler;
+      dst[i] = convert(src[i] * scaler);
     }
 }
 
-// CF32 <> CU8
-static void genericCF32toCU8(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+// CF32 > CS12
+static void genericCF32toCS12Saturating(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
 {
   const size_t elemDepth = 2;
 
   auto *src = (float*)srcBuff;
   auto *dst = (uint8_t*)dstBuff;
-  for (size_t i = 0; i < numElems*elemDepth; i++)
+  for (size_t i = 0; i < numElems; i++)
     {
-      dst[i] = SoapySDR::F32toU8(src[i] * scaler);
+      const float tmp[elemDepth] = {float(src[i*elemDepth+0] * scaler), float(src[i*elemDepth+1] * scaler)};
+      SoapySDR::CF32toCS12Saturating(tmp, dst+i*3);
     }
 }
 
-static void genericCU8toCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+// ********************************
+// Correction Converters
+//
+// The scaler, the DC offset, and the IQ matrix are folded into one
+// affine transform of each complex sample, so the correction costs
+// a few multiply-adds in the conversion pass.
+
+template <typename SrcType, float (*convert)(SrcType)>
+static void genericCorrectToCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler, const SoapySDR::ConverterRegistry::Correction &correction)
 {
   const size_t elemDepth = 2;
 
-  auto *src = (uint8_t*)srcBuff;
+  //out = matrix * (scaler * x - dcOffset)
+  const auto &m = correction.matrix;
+  const float a00 = m[0][0]*scaler, a01 = m[0][1]*scaler;
+  const float a10 = m[1][0]*scaler, a11 = m[1][1]*scaler;
+  const float bI = -(m[0][0]*correction.dcOffset.real() + m[0][1]*correction.dcOffset.imag());
+  const float bQ = -(m[1][0]*correction.dcOffset.real() + m[1][1]*correction.dcOffset.imag());
+
+  auto *src = (SrcType*)srcBuff;
   auto *dst = (float*)dstBuff;
-  for (size_t i = 0; i < numElems*elemDepth; i++)
+  for (size_t i = 0; i < numElems; i++)
     {
-      dst[i] = SoapySDR::U8toF32(src[i]) * scaler;
+      const float xI = convert(src[i*elemDepth+0]);
+      const float xQ = convert(src[i*elemDepth+1]);
+      dst[i*elemDepth+0] = a00*xI + a01*xQ + bI;
+      dst[i*elemDepth+1] = a10*xI + a11*xQ + bQ;
     }
 }
 
-// CS16 <> CU16
-static void genericCS16toCU16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
-{
-  const size_t elemDepth = 2;
+// ********************************
+// Deinterleave and Interleave Converters
+//
+// A deinterleaver splits numElems*numChans channel-interleaved source elements
+// into numChans planar target buffers, and an interleaver does the inverse.
+// Planar I and Q buffers are the real format with two channels,
+// while the complex formats move whole I/Q elements between channels.
 
-  auto *src = (int16_t*)srcBuff;
-  auto *dst = (uint16_t*)dstBuff;
-  for (size_t i = 0; i < numElems*elemDepth; i++)
-    {
-      dst[i] = SoapySDR::S16toU16(src[i] * scaler);
-    }
+// Scaled element conversions, the scaler is applied on the float side
+static float scaledF32toF32(const float from, const double scaler)
+{
+  return from * scaler;
 }
 
-static void genericCU16toCS16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+static int16_t scaledS16toS16(const int16_t from, const double scaler)
 {
-  const size_t elemDepth = 2;
-
-  auto *src = (uint16_t*)srcBuff;
-  auto *dst = (int16_t*)dstBuff;
-  for (size_t i = 0; i < numElems*elemDepth; i++)
-    {
-      dst[i] = SoapySDR::U16toS16(src[i]) * scaler;
-    }
+  return from * scaler;
 }
 
-// CS16 <> CS8
-static void genericCS16toCS8(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+static float scaledS16toF32(const int16_t from, const double scaler)
 {
-  const size_t elemDepth = 2;
-
-  auto *src = (int16_t*)srcBuff;
-  auto *dst = (int8_t*)dstBuff;
-  for (size_t i = 0; i < numElems*elemDepth; i++)
-    {
-      dst[i] = SoapySDR::S16toS8(src[i] * scaler);
-    }
+  return SoapySDR::S16toF32(from) * scaler;
 }
 
-static void genericCS8toCS16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+static int16_t scaledF32toS16(const float from, const double scaler)
 {
-  const size_t elemDepth = 2;
-
-  auto *src = (int8_t*)srcBuff;
-  auto *dst = (int16_t*)dstBuff;
-  for (size_t i = 0; i < numElems*elemDepth; i++)
-    {
-      dst[i] = SoapySDR::S8toS16(src[i]) * scaler;
-    }
+  return SoapySDR::F32toS16(from * scaler);
 }
 
-// CS16 <> CU8
-static void genericCS16toCU8(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+static float scaledS8toF32(const int8_t from, const double scaler)
 {
-  const size_t elemDepth = 2;
-
-  auto *src = (int16_t*)srcBuff;
-  auto *dst = (uint8_t*)dstBuff;
-  for (size_t i = 0; i < numElems*elemDepth; i++)
-    {
-      dst[i] = SoapySDR::S16toU8(src[i] * scaler);
-    }
+  return SoapySDR::S8toF32(from) * scaler;
 }
 
-static void genericCU8toCS16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+static int8_t scaledF32toS8(const float from, const double scaler)
 {
-  const size_t elemDepth = 2;
-
-  auto *src = (uint8_t*)srcBuff;
-  auto *dst = (int16_t*)dstBuff;
-  for (size_t i = 0; i < numElems*elemDepth; i++)
-    {
-      dst[i] = SoapySDR::U8toS16(src[i]) * scaler;
-    }
+  return SoapySDR::F32toS8(from * scaler);
 }
 
-// CU16 <> CS8
-static void genericCU16toCS8(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+static float scaledU8toF32(const uint8_t from, const double scaler)
 {
-  const size_t elemDepth = 2;
-
-  auto *src = (uint16_t*)srcBuff;
-  auto *dst = (int8_t*)dstBuff;
-  for (size_t i = 0; i < numElems*elemDepth; i++)
-    {
-      dst[i] = SoapySDR::U16toS8(src[i] * scaler);
-    }
+  return SoapySDR::U8toF32(from) * scaler;
 }
 
-static void genericCS8toCU16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+static uint8_t scaledF32toU8(const float from, const double scaler)
 {
-  const size_t elemDepth = 2;
-
-  auto *src = (int8_t*)srcBuff;
-  auto *dst = (uint16_t*)dstBuff;
-  for (size_t i = 0; i < numElems*elemDepth; i++)
-    {
-      dst[i] = SoapySDR::S8toU16(src[i]) * scaler;
-    }
+  return SoapySDR::F32toU8(from * scaler);
 }
 
-// CS8 <> CU8
-static void genericCS8toCU8(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+// elemDepth is the number of scalar values per element of each channel
+template <typename SrcType, typename DstType, DstType (*convert)(const SrcType, const double), size_t elemDepth>
+static void genericDeinterleave(const void *srcBuff, void * const *dstBuffs, const size_t numChans, const size_t numElems, const double scaler)
 {
-  const size_t elemDepth = 2;
-
-  auto *src = (int8_t*)srcBuff;
-  auto *dst = (uint8_t*)dstBuff;
-  for (size_t i = 0; i < numElems*elemDepth; i++)
+  auto *src = (const SrcType*)srcBuff;
+  for (size_t i = 0; i < numElems; i++)
     {
-      dst[i] = SoapySDR::S8toU8(src[i] * scaler);
+      for (size_t ch = 0; ch < numChans; ch++)
+        {
+          auto *dst = (DstType*)dstBuffs[ch] + i*elemDepth;
+          for (size_t j = 0; j < elemDepth; j++)
+            {
+              dst[j] = convert(src[j], scaler);
+            }
+          src += elemDepth;
+        }
     }
 }
 
-static void genericCU8toCS8(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+template <typename SrcType, typename DstType, DstType (*convert)(const SrcType, const double), size_t elemDepth>
+static void genericInterleave(const void * const *srcBuffs, void *dstBuff, const size_t numChans, const size_t numElems, const double scaler)
 {
-  const size_t elemDepth = 2;
-
-  auto *src = (uint8_t*)srcBuff;
-  auto *dst = (int8_t*)dstBuff;
-  for (size_t i = 0; i < numElems*elemDepth; i++)
+  auto *dst = (DstType*)dstBuff;
+  for (size_t i = 0; i < numElems; i++)
     {
-      dst[i] = SoapySDR::U8toS8(src[i]) * scaler;
+      for (size_t ch = 0; ch < numChans; ch++)
+        {
+          auto *src = (const SrcType*)srcBuffs[ch] + i*elemDepth;
+          for (size_t j = 0; j < elemDepth; j++)
+            {
+              dst[j] = convert(src[j], scaler);
+            }
+          dst += elemDepth;
+        }
     }
 }
 
+void lateLoadVectorizedConverters(void);
+
 /*!
  * lateLoadDefaultConverters() is called by loadModules()
  * to load the converters on-demand/not statically.
@@ -651,48 +654,81 @@ static void genericCU8toCS8(const void *srcBuff, void *dstBuff, const size_t num
  */
 void lateLoadDefaultConverters(void)
 {
-    static SoapySDR::ConverterRegistry registerGenericF32toF32(SOAPY_SDR_F32, SOAPY_SDR_F32, SoapySDR::ConverterRegistry::GENERIC, &genericF32toF32);
-    static SoapySDR::ConverterRegistry registerGenericS32toS32(SOAPY_SDR_S32, SOAPY_SDR_S32, SoapySDR::ConverterRegistry::GENERIC, &genericS32toS32);
-    static SoapySDR::ConverterRegistry registerGenericS16toS16(SOAPY_SDR_S16, SOAPY_SDR_S16, SoapySDR::ConverterRegistry::GENERIC, &genericS16toS16);
-    static SoapySDR::ConverterRegistry registerGenericS8toS8(SOAPY_SDR_S8, SOAPY_SDR_S8, SoapySDR::ConverterRegistry::GENERIC, &genericS8toS8);
-    static SoapySDR::ConverterRegistry registerGenericF32toS16(SOAPY_SDR_F32, SOAPY_SDR_S16, SoapySDR::ConverterRegistry::GENERIC, &genericF32toS16);
-    static SoapySDR::ConverterRegistry registerGenericS16toF32(SOAPY_SDR_S16, SOAPY_SDR_F32, SoapySDR::ConverterRegistry::GENERIC, &genericS16toF32);
-    static SoapySDR::ConverterRegistry registerGenericF32toU16(SOAPY_SDR_F32, SOAPY_SDR_U16, SoapySDR::ConverterRegistry::GENERIC, &genericF32toU16);
-    static SoapySDR::ConverterRegistry registerGenericU16toF32(SOAPY_SDR_U16, SOAPY_SDR_F32, SoapySDR::ConverterRegistry::GENERIC, &genericU16toF32);
-    static SoapySDR::ConverterRegistry registerGenericF32toS8(SOAPY_SDR_F32, SOAPY_SDR_S8, SoapySDR::ConverterRegistry::GENERIC, &genericF32toS8);
-    static SoapySDR::ConverterRegistry registerGenericS8toF32(SOAPY_SDR_S8, SOAPY_SDR_F32, SoapySDR::ConverterRegistry::GENERIC, &genericS8toF32);
-    static SoapySDR::ConverterRegistry registerGenericF32toU8(SOAPY_SDR_F32, SOAPY_SDR_U8, SoapySDR::ConverterRegistry::GENERIC, &genericF32toU8);
-    static SoapySDR::ConverterRegistry registerGenericU8toF32(SOAPY_SDR_U8, SOAPY_SDR_F32, SoapySDR::ConverterRegistry::GENERIC, &genericU8toF32);
-    static SoapySDR::ConverterRegistry registerGenericS16toU16(SOAPY_SDR_S16, SOAPY_SDR_U16, SoapySDR::ConverterRegistry::GENERIC, &genericS16toU16);
-    static SoapySDR::ConverterRegistry registerGenericU16toS16(SOAPY_SDR_U16, SOAPY_SDR_S16, SoapySDR::ConverterRegistry::GENERIC, &genericU16toS16);
-    static SoapySDR::ConverterRegistry registerGenericS16toS8(SOAPY_SDR_S16, SOAPY_SDR_S8, SoapySDR::ConverterRegistry::GENERIC, &genericS16toS8);
-    static SoapySDR::ConverterRegistry registerGenericS8toS16(SOAPY_SDR_S8, SOAPY_SDR_S16, SoapySDR::ConverterRegistry::GENERIC, &genericS8toS16);
-    static SoapySDR::ConverterRegistry registerGenericS16toU8(SOAPY_SDR_S16, SOAPY_SDR_U8, SoapySDR::ConverterRegistry::GENERIC, &genericS16toU8);
-    static SoapySDR::ConverterRegistry registerGenericU8toS16(SOAPY_SDR_U8, SOAPY_SDR_S16, SoapySDR::ConverterRegistry::GENERIC, &genericU8toS16);
-    static SoapySDR::ConverterRegistry registerGenericU16toS8(SOAPY_SDR_U16, SOAPY_SDR_S8, SoapySDR::ConverterRegistry::GENERIC, &genericU16toS8);
-    static SoapySDR::ConverterRegistry registerGenericS8toU16(SOAPY_SDR_S8, SOAPY_SDR_U16, SoapySDR::ConverterRegistry::GENERIC, &genericS8toU16);
-    static SoapySDR::ConverterRegistry registerGenericS8toU8(SOAPY_SDR_S8, SOAPY_SDR_U8, SoapySDR::ConverterRegistry::GENERIC, &genericS8toU8);
-    static SoapySDR::ConverterRegistry registerGenericU8toS8(SOAPY_SDR_U8, SOAPY_SDR_S8, SoapySDR::ConverterRegistry::GENERIC, &genericU8toS8);
-    static SoapySDR::ConverterRegistry registerGenericCF32toCF32(SOAPY_SDR_CF32, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::GENERIC, &genericCF32toCF32);
-    static SoapySDR::ConverterRegistry registerGenericCS32toCS32(SOAPY_SDR_CS32, SOAPY_SDR_CS32, SoapySDR::ConverterRegistry::GENERIC, &genericCS32toCS32);
-    static SoapySDR::ConverterRegistry registerGenericCS16toCS16(SOAPY_SDR_CS16, SOAPY_SDR_CS16, SoapySDR::ConverterRegistry::GENERIC, &genericCS16toCS16);
-    static SoapySDR::ConverterRegistry registerGenericCS8toCS8(SOAPY_SDR_CS8, SOAPY_SDR_CS8, SoapySDR::ConverterRegistry::GENERIC, &genericCS8toCS8);
-    static SoapySDR::ConverterRegistry registerGenericCF32toCS16(SOAPY_SDR_CF32, SOAPY_SDR_CS16, SoapySDR::ConverterRegistry::GENERIC, &genericCF32toCS16);
-    static SoapySDR::ConverterRegistry registerGenericCS16toCF32(SOAPY_SDR_CS16, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::GENERIC, &genericCS16toCF32);
-    static SoapySDR::ConverterRegistry registerGenericCF32toCU16(SOAPY_SDR_CF32, SOAPY_SDR_CU16, SoapySDR::ConverterRegistry::GENERIC, &genericCF32toCU16);
-    static SoapySDR::ConverterRegistry registerGenericCU16toCF32(SOAPY_SDR_CU16, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::GENERIC, &genericCU16toCF32);
-    static SoapySDR::ConverterRegistry registerGenericCF32toCS8(SOAPY_SDR_CF32, SOAPY_SDR_CS8, SoapySDR::ConverterRegistry::GENERIC, &genericCF32toCS8);
-    static SoapySDR::ConverterRegistry registerGenericCS8toCF32(SOAPY_SDR_CS8, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::GENERIC, &genericCS8toCF32);
-    static SoapySDR::ConverterRegistry registerGenericCF32toCU8(SOAPY_SDR_CF32, SOAPY_SDR_CU8, SoapySDR::ConverterRegistry::GENERIC, &genericCF32toCU8);
-    static SoapySDR::ConverterRegistry registerGenericCU8toCF32(SOAPY_SDR_CU8, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::GENERIC, &genericCU8toCF32);
-    static SoapySDR::ConverterRegistry registerGenericCS16toCU16(SOAPY_SDR_CS16, SOAPY_SDR_CU16, SoapySDR::ConverterRegistry::GENERIC, &genericCS16toCU16);
-    static SoapySDR::ConverterRegistry registerGenericCU16toCS16(SOAPY_SDR_CU16, SOAPY_SDR_CS16, SoapySDR::ConverterRegistry::GENERIC, &genericCU16toCS16);
-    static SoapySDR::ConverterRegistry registerGenericCS16toCS8(SOAPY_SDR_CS16, SOAPY_SDR_CS8, SoapySDR::ConverterRegistry::GENERIC, &genericCS16toCS8);
-    static SoapySDR::ConverterRegistry registerGenericCS8toCS16(SOAPY_SDR_CS8, SOAPY_SDR_CS16, SoapySDR::ConverterRegistry::GENERIC, &genericCS8toCS16);
-    static SoapySDR::ConverterRegistry registerGenericCS16toCU8(SOAPY_SDR_CS16, SOAPY_SDR_CU8, SoapySDR::ConverterRegistry::GENERIC, &genericCS16toCU8);
-    static SoapySDR::ConverterRegistry registerGenericCU8toCS16(SOAPY_SDR_CU8, SOAPY_SDR_CS16, SoapySDR::ConverterRegistry::GENERIC, &genericCU8toCS16);
-    static SoapySDR::ConverterRegistry registerGenericCU16toCS8(SOAPY_SDR_CU16, SOAPY_SDR_CS8, SoapySDR::ConverterRegistry::GENERIC, &genericCU16toCS8);
-    static SoapySDR::ConverterRegistry registerGenericCS8toCU16(SOAPY_SDR_CS8, SOAPY_SDR_CU16, SoapySDR::ConverterRegistry::GENERIC, &genericCS8toCU16);
-    static SoapySDR::ConverterRegistry registerGenericCS8toCU8(SOAPY_SDR_CS8, SOAPY_SDR_CU8, SoapySDR::ConverterRegistry::GENERIC, &genericCS8toCU8);
-    static SoapySDR::ConverterRegistry registerGenericCU8toCS8(SOAPY_SDR_CU8, SOAPY_SDR_CS8, SoapySDR::ConverterRegistry::GENERIC, &genericCU8toCS8);
+    static const bool registeredMatrix = FormatMatrix<FormatF64, FormatF32, FormatS32, FormatU32, FormatS16, FormatU16, FormatS8, FormatU8>::registerAll();
+    (void)registeredMatrix;
+
+    static SoapySDR::ConverterRegistry registerGenericCS12toCS16(SOAPY_SDR_CS12, SOAPY_SDR_CS16, SoapySDR::ConverterRegistry::GENERIC, &genericCS12toCS16);
+    static SoapySDR::ConverterRegistry registerGenericCS16toCS12(SOAPY_SDR_CS16, SOAPY_SDR_CS12, SoapySDR::ConverterRegistry::GENERIC, &genericCS16toCS12);
+    static SoapySDR::ConverterRegistry registerGenericCS12toCF32(SOAPY_SDR_CS12, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::GENERIC, &genericCS12toCF32);
+    static SoapySDR::ConverterRegistry registerGenericCF32toCS12(SOAPY_SDR_CF32, SOAPY_SDR_CS12, SoapySDR::ConverterRegistry::GENERIC, &genericCF32toCS12);
+    static SoapySDR::ConverterRegistry registerGenericCS4toCS8(SOAPY_SDR_CS4, SOAPY_SDR_CS8, SoapySDR::ConverterRegistry::GENERIC, &genericCS4toCS8);
+    static SoapySDR::ConverterRegistry registerGenericCS8toCS4(SOAPY_SDR_CS8, SOAPY_SDR_CS4, SoapySDR::ConverterRegistry::GENERIC, &genericCS8toCS4);
+    static SoapySDR::ConverterRegistry registerGenericCS4toCF32(SOAPY_SDR_CS4, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::GENERIC, &genericCS4toCF32);
+    static SoapySDR::ConverterRegistry registerGenericCF32toCS4(SOAPY_SDR_CF32, SOAPY_SDR_CS4, SoapySDR::ConverterRegistry::GENERIC, &genericCF32toCS4);
+
+    static SoapySDR::ConverterRegistry registerGenericDeinterleaveF32toF32(SOAPY_SDR_F32, SOAPY_SDR_F32, SoapySDR::ConverterRegistry::GENERIC, &genericDeinterleave<float, float, &scaledF32toF32, 1>);
+    static SoapySDR::ConverterRegistry registerGenericInterleaveF32toF32(SOAPY_SDR_F32, SOAPY_SDR_F32, SoapySDR::ConverterRegistry::GENERIC, &genericInterleave<float, float, &scaledF32toF32, 1>);
+    static SoapySDR::ConverterRegistry registerGenericDeinterleaveS16toS16(SOAPY_SDR_S16, SOAPY_SDR_S16, SoapySDR::ConverterRegistry::GENERIC, &genericDeinterleave<int16_t, int16_t, &scaledS16toS16, 1>);
+    static SoapySDR::ConverterRegistry registerGenericInterleaveS16toS16(SOAPY_SDR_S16, SOAPY_SDR_S16, SoapySDR::ConverterRegistry::GENERIC, &genericInterleave<int16_t, int16_t, &scaledS16toS16, 1>);
+    static SoapySDR::ConverterRegistry registerGenericDeinterleaveS16toF32(SOAPY_SDR_S16, SOAPY_SDR_F32, SoapySDR::ConverterRegistry::GENERIC, &genericDeinterleave<int16_t, float, &scaledS16toF32, 1>);
+    static SoapySDR::ConverterRegistry registerGenericInterleaveS16toF32(SOAPY_SDR_S16, SOAPY_SDR_F32, SoapySDR::ConverterRegistry::GENERIC, &genericInterleave<int16_t, float, &scaledS16toF32, 1>);
+    static SoapySDR::ConverterRegistry registerGenericDeinterleaveF32toS16(SOAPY_SDR_F32, SOAPY_SDR_S16, SoapySDR::ConverterRegistry::GENERIC, &genericDeinterleave<float, int16_t, &scaledF32toS16, 1>);
+    static SoapySDR::ConverterRegistry registerGenericInterleaveF32toS16(SOAPY_SDR_F32, SOAPY_SDR_S16, SoapySDR::ConverterRegistry::GENERIC, &genericInterleave<float, int16_t, &scaledF32toS16, 1>);
+    static SoapySDR::ConverterRegistry registerGenericDeinterleaveS8toF32(SOAPY_SDR_S8, SOAPY_SDR_F32, SoapySDR::ConverterRegistry::GENERIC, &genericDeinterleave<int8_t, float, &scaledS8toF32, 1>);
+    static SoapySDR::ConverterRegistry registerGenericInterleaveS8toF32(SOAPY_SDR_S8, SOAPY_SDR_F32, SoapySDR::ConverterRegistry::GENERIC, &genericInterleave<int8_t, float, &scaledS8toF32, 1>);
+    static SoapySDR::ConverterRegistry registerGenericDeinterleaveF32toS8(SOAPY_SDR_F32, SOAPY_SDR_S8, SoapySDR::ConverterRegistry::GENERIC, &genericDeinterleave<float, int8_t, &scaledF32toS8, 1>);
+    static SoapySDR::ConverterRegistry registerGenericInterleaveF32toS8(SOAPY_SDR_F32, SOAPY_SDR_S8, SoapySDR::ConverterRegistry::GENERIC, &genericInterleave<float, int8_t, &scaledF32toS8, 1>);
+    static SoapySDR::ConverterRegistry registerGenericDeinterleaveU8toF32(SOAPY_SDR_U8, SOAPY_SDR_F32, SoapySDR::ConverterRegistry::GENERIC, &genericDeinterleave<uint8_t, float, &scaledU8toF32, 1>);
+    static SoapySDR::ConverterRegistry registerGenericInterleaveU8toF32(SOAPY_SDR_U8, SOAPY_SDR_F32, SoapySDR::ConverterRegistry::GENERIC, &genericInterleave<uint8_t, float, &scaledU8toF32, 1>);
+    static SoapySDR::ConverterRegistry registerGenericDeinterleaveF32toU8(SOAPY_SDR_F32, SOAPY_SDR_U8, SoapySDR::ConverterRegistry::GENERIC, &genericDeinterleave<float, uint8_t, &scaledF32toU8, 1>);
+    static SoapySDR::ConverterRegistry registerGenericInterleaveF32toU8(SOAPY_SDR_F32, SOAPY_SDR_U8, SoapySDR::ConverterRegistry::GENERIC, &genericInterleave<float, uint8_t, &scaledF32toU8, 1>);
+    static SoapySDR::ConverterRegistry registerGenericDeinterleaveCF32toCF32(SOAPY_SDR_CF32, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::GENERIC, &genericDeinterleave<float, float, &scaledF32toF32, 2>);
+    static SoapySDR::ConverterRegistry registerGenericInterleaveCF32toCF32(SOAPY_SDR_CF32, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::GENERIC, &genericInterleave<float, float, &scaledF32toF32, 2>);
+    static SoapySDR::ConverterRegistry registerGenericDeinterleaveCS16toCS16(SOAPY_SDR_CS16, SOAPY_SDR_CS16, SoapySDR::ConverterRegistry::GENERIC, &genericDeinterleave<int16_t, int16_t, &scaledS16toS16, 2>);
+    static SoapySDR::ConverterRegistry registerGenericInterleaveCS16toCS16(SOAPY_SDR_CS16, SOAPY_SDR_CS16, SoapySDR::ConverterRegistry::GENERIC, &genericInterleave<int16_t, int16_t, &scaledS16toS16, 2>);
+    static SoapySDR::ConverterRegistry registerGenericDeinterleaveCS16toCF32(SOAPY_SDR_CS16, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::GENERIC, &genericDeinterleave<int16_t, float, &scaledS16toF32, 2>);
+    static SoapySDR::ConverterRegistry registerGenericInterleaveCS16toCF32(SOAPY_SDR_CS16, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::GENERIC, &genericInterleave<int16_t, float, &scaledS16toF32, 2>);
+    static SoapySDR::ConverterRegistry registerGenericDeinterleaveCF32toCS16(SOAPY_SDR_CF32, SOAPY_SDR_CS16, SoapySDR::ConverterRegistry::GENERIC, &genericDeinterleave<float, int16_t, &scaledF32toS16, 2>);
+    static SoapySDR::ConverterRegistry registerGenericInterleaveCF32toCS16(SOAPY_SDR_CF32, SOAPY_SDR_CS16, SoapySDR::ConverterRegistry::GENERIC, &genericInterleave<float, int16_t, &scaledF32toS16, 2>);
+    static SoapySDR::ConverterRegistry registerGenericDeinterleaveCS8toCF32(SOAPY_SDR_CS8, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::GENERIC, &genericDeinterleave<int8_t, float, &scaledS8toF32, 2>);
+    static SoapySDR::ConverterRegistry registerGenericInterleaveCS8toCF32(SOAPY_SDR_CS8, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::GENERIC, &genericInterleave<int8_t, float, &scaledS8toF32, 2>);
+    static SoapySDR::ConverterRegistry registerGenericDeinterleaveCF32toCS8(SOAPY_SDR_CF32, SOAPY_SDR_CS8, SoapySDR::ConverterRegistry::GENERIC, &genericDeinterleave<float, int8_t, &scaledF32toS8, 2>);
+    static SoapySDR::ConverterRegistry registerGenericInterleaveCF32toCS8(SOAPY_SDR_CF32, SOAPY_SDR_CS8, SoapySDR::ConverterRegistry::GENERIC, &genericInterleave<float, int8_t, &scaledF32toS8, 2>);
+    static SoapySDR::ConverterRegistry registerGenericDeinterleaveCU8toCF32(SOAPY_SDR_CU8, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::GENERIC, &genericDeinterleave<uint8_t, float, &scaledU8toF32, 2>);
+    static SoapySDR::ConverterRegistry registerGenericInterleaveCU8toCF32(SOAPY_SDR_CU8, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::GENERIC, &genericInterleave<uint8_t, float, &scaledU8toF32, 2>);
+    static SoapySDR::ConverterRegistry registerGenericDeinterleaveCF32toCU8(SOAPY_SDR_CF32, SOAPY_SDR_CU8, SoapySDR::ConverterRegistry::GENERIC, &genericDeinterleave<float, uint8_t, &scaledF32toU8, 2>);
+    static SoapySDR::ConverterRegistry registerGenericInterleaveCF32toCU8(SOAPY_SDR_CF32, SOAPY_SDR_CU8, SoapySDR::ConverterRegistry::GENERIC, &genericInterleave<float, uint8_t, &scaledF32toU8, 2>);
+
+    static SoapySDR::ConverterRegistry registerGenericS16BEtoS16(SOAPY_SDR_S16BE, SOAPY_SDR_S16, SoapySDR::ConverterRegistry::GENERIC, &genericSwap<int16_t, &SoapySDR::S16BEtoS16, 1, false>);
+    static SoapySDR::ConverterRegistry registerGenericS16toS16BE(SOAPY_SDR_S16, SOAPY_SDR_S16BE, SoapySDR::ConverterRegistry::GENERIC, &genericSwap<int16_t, &SoapySDR::S16toS16BE, 1, true>);
+    static SoapySDR::ConverterRegistry registerGenericS16BEtoF32(SOAPY_SDR_S16BE, SOAPY_SDR_F32, SoapySDR::ConverterRegistry::GENERIC, &genericSwapToFloat<int16_t, float, &SoapySDR::S16BEtoS16, &SoapySDR::S16toF32, 1>);
+    static SoapySDR::ConverterRegistry registerGenericF32toS16BE(SOAPY_SDR_F32, SOAPY_SDR_S16BE, SoapySDR::ConverterRegistry::GENERIC, &genericFloatToSwap<float, int16_t, &SoapySDR::F32toS16, &SoapySDR::S16toS16BE, 1>);
+    static SoapySDR::ConverterRegistry registerGenericS32BEtoS32(SOAPY_SDR_S32BE, SOAPY_SDR_S32, SoapySDR::ConverterRegistry::GENERIC, &genericSwap<int32_t, &SoapySDR::S32BEtoS32, 1, false>);
+    static SoapySDR::ConverterRegistry registerGenericS32toS32BE(SOAPY_SDR_S32, SOAPY_SDR_S32BE, SoapySDR::ConverterRegistry::GENERIC, &genericSwap<int32_t, &SoapySDR::S32toS32BE, 1, true>);
+    static SoapySDR::ConverterRegistry registerGenericS32BEtoF64(SOAPY_SDR_S32BE, SOAPY_SDR_F64, SoapySDR::ConverterRegistry::GENERIC, &genericSwapToFloat<int32_t, double, &SoapySDR::S32BEtoS32, &SoapySDR::S32toF64, 1>);
+    static SoapySDR::ConverterRegistry registerGenericF64toS32BE(SOAPY_SDR_F64, SOAPY_SDR_S32BE, SoapySDR::ConverterRegistry::GENERIC, &genericFloatToSwap<double, int32_t, &SoapySDR::F64toS32, &SoapySDR::S32toS32BE, 1>);
+    static SoapySDR::ConverterRegistry registerGenericCS16BEtoCS16(SOAPY_SDR_CS16BE, SOAPY_SDR_CS16, SoapySDR::ConverterRegistry::GENERIC, &genericSwap<int16_t, &SoapySDR::S16BEtoS16, 2, false>);
+    static SoapySDR::ConverterRegistry registerGenericCS16toCS16BE(SOAPY_SDR_CS16, SOAPY_SDR_CS16BE, SoapySDR::ConverterRegistry::GENERIC, &genericSwap<int16_t, &SoapySDR::S16toS16BE, 2, true>);
+    static SoapySDR::ConverterRegistry registerGenericCS16BEtoCF32(SOAPY_SDR_CS16BE, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::GENERIC, &genericSwapToFloat<int16_t, float, &SoapySDR::S16BEtoS16, &SoapySDR::S16toF32, 2>);
+    static SoapySDR::ConverterRegistry registerGenericCF32toCS16BE(SOAPY_SDR_CF32, SOAPY_SDR_CS16BE, SoapySDR::ConverterRegistry::GENERIC, &genericFloatToSwap<float, int16_t, &SoapySDR::F32toS16, &SoapySDR::S16toS16BE, 2>);
+    static SoapySDR::ConverterRegistry registerGenericCS32BEtoCS32(SOAPY_SDR_CS32BE, SOAPY_SDR_CS32, SoapySDR::ConverterRegistry::GENERIC, &genericSwap<int32_t, &SoapySDR::S32BEtoS32, 2, false>);
+    static SoapySDR::ConverterRegistry registerGenericCS32toCS32BE(SOAPY_SDR_CS32, SOAPY_SDR_CS32BE, SoapySDR::ConverterRegistry::GENERIC, &genericSwap<int32_t, &SoapySDR::S32toS32BE, 2, true>);
+    static SoapySDR::ConverterRegistry registerGenericCS32BEtoCF64(SOAPY_SDR_CS32BE, SOAPY_SDR_CF64, SoapySDR::ConverterRegistry::GENERIC, &genericSwapToFloat<int32_t, double, &SoapySDR::S32BEtoS32, &SoapySDR::S32toF64, 2>);
+    static SoapySDR::ConverterRegistry registerGenericCF64toCS32BE(SOAPY_SDR_CF64, SOAPY_SDR_CS32BE, SoapySDR::ConverterRegistry::GENERIC, &genericFloatToSwap<double, int32_t, &SoapySDR::F64toS32, &SoapySDR::S32toS32BE, 2>);
+    static SoapySDR::ConverterRegistry registerSaturatingF32toS16(SOAPY_SDR_F32, SOAPY_SDR_S16, SoapySDR::ConverterRegistry::GENERIC, SoapySDR::ConverterRegistry::SATURATING, &genericSaturating<int16_t, &SoapySDR::F32toS16Saturating, 1>);
+    static SoapySDR::ConverterRegistry registerSaturatingF32toS8(SOAPY_SDR_F32, SOAPY_SDR_S8, SoapySDR::ConverterRegistry::GENERIC, SoapySDR::ConverterRegistry::SATURATING, &genericSaturating<int8_t, &SoapySDR::F32toS8Saturating, 1>);
+    static SoapySDR::ConverterRegistry registerSaturatingF32toU8(SOAPY_SDR_F32, SOAPY_SDR_U8, SoapySDR::ConverterRegistry::GENERIC, SoapySDR::ConverterRegistry::SATURATING, &genericSaturating<uint8_t, &SoapySDR::F32toU8Saturating, 1>);
+    static SoapySDR::ConverterRegistry registerSaturatingCF32toCS16(SOAPY_SDR_CF32, SOAPY_SDR_CS16, SoapySDR::ConverterRegistry::GENERIC, SoapySDR::ConverterRegistry::SATURATING, &genericSaturating<int16_t, &SoapySDR::F32toS16Saturating, 2>);
+    static SoapySDR::ConverterRegistry registerSaturatingCF32toCS8(SOAPY_SDR_CF32, SOAPY_SDR_CS8, SoapySDR::ConverterRegistry::GENERIC, SoapySDR::ConverterRegistry::SATURATING, &genericSaturating<int8_t, &SoapySDR::F32toS8Saturating, 2>);
+    static SoapySDR::ConverterRegistry registerSaturatingCF32toCU8(SOAPY_SDR_CF32, SOAPY_SDR_CU8, SoapySDR::ConverterRegistry::GENERIC, SoapySDR::ConverterRegistry::SATURATING, &genericSaturating<uint8_t, &SoapySDR::F32toU8Saturating, 2>);
+    static SoapySDR::ConverterRegistry registerSaturatingCF32toCS12(SOAPY_SDR_CF32, SOAPY_SDR_CS12, SoapySDR::ConverterRegistry::GENERIC, SoapySDR::ConverterRegistry::SATURATING, &genericCF32toCS12Saturating);
+
+    static SoapySDR::ConverterRegistry registerGenericCorrectCS16toCF32(SOAPY_SDR_CS16, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::GENERIC, &genericCorrectToCF32<int16_t, &SoapySDR::S16toF32>);
+    static SoapySDR::ConverterRegistry registerGenericCorrectCS8toCF32(SOAPY_SDR_CS8, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::GENERIC, &genericCorrectToCF32<int8_t, &SoapySDR::S8toF32>);
+    static SoapySDR::ConverterRegistry registerGenericCorrectCU8toCF32(SOAPY_SDR_CU8, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::GENERIC, &genericCorrectToCF32<uint8_t, &SoapySDR::U8toF32>);
+    static SoapySDR::ConverterRegistry registerGenericStatisticsCS16toCF32(SOAPY_SDR_CS16, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::GENERIC, &genericStatisticsToCF32<int16_t, &SoapySDR::S16toF32>);
+    static SoapySDR::ConverterRegistry registerGenericStatisticsCS8toCF32(SOAPY_SDR_CS8, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::GENERIC, &genericStatisticsToCF32<int8_t, &SoapySDR::S8toF32>);
+    static SoapySDR::ConverterRegistry registerGenericStatisticsCU8toCF32(SOAPY_SDR_CU8, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::GENERIC, &genericStatisticsToCF32<uint8_t, &SoapySDR::U8toF32>);
+
+    lateLoadVectorizedConverters();
 }
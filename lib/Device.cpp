@@ -4,9 +4,16 @@
 // SPDX-License-Identifier: BSL-1.0
 
 #include <SoapySDR/Device.hpp>
+#include <SoapySDR/DirectAccess.hpp>
 #include <SoapySDR/Formats.hpp>
+#include <SoapySDR/Logger.hpp>
 #include <cstdlib>
 #include <algorithm> //min/max/find
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
 
 SoapySDR::Device::~Device(void)
 {
@@ -123,6 +130,104 @@ int SoapySDR::Device::readStreamStatus(Stream *, size_t &, int &, long long &, c
     return SOAPY_SDR_NOT_SUPPORTED;
 }
 
+/*******************************************************************
+ * Async stream API
+ ******************************************************************/
+
+/*!
+ * The default async stream delivers the buffers of a DirectAccessRing
+ * to the callback from a thread which is owned by the worker.
+ */
+struct AsyncStreamWorker
+{
+    AsyncStreamWorker(SoapySDR::Device *device, SoapySDR::Stream *stream, const SoapySDR::AsyncStreamCallback &callback, const std::string &format, const size_t numChans, const size_t numBuffs):
+        ring(device, stream, SOAPY_SDR_RX, numChans, format, numBuffs),
+        callback(callback),
+        numChans(numChans),
+        running(true)
+    {
+        ring.start();
+        thread = std::thread(&AsyncStreamWorker::loop, this);
+    }
+
+    ~AsyncStreamWorker(void)
+    {
+        running = false;
+        thread.join();
+        ring.stop();
+    }
+
+    void loop(void)
+    {
+        std::vector<const void *> buffs(numChans);
+        while (running)
+        {
+            size_t handle(0);
+            int flags(0);
+            long long timeNs(0);
+            const int ret = ring.acquireReadBuffer(handle, buffs.data(), flags, timeNs);
+            if (ret == SOAPY_SDR_TIMEOUT) continue;
+            try
+            {
+                callback((ret < 0)?nullptr:buffs.data(), ret, flags, timeNs);
+            }
+            catch (const std::exception &ex)
+            {
+                SoapySDR::logf(SOAPY_SDR_ERROR, "AsyncStreamCallback threw: %s", ex.what());
+            }
+            if (ret >= 0) ring.releaseReadBuffer(handle);
+
+            //the stream continues after dropped samples, other errors end the callbacks
+            if (ret < 0 and ret != SOAPY_SDR_OVERFLOW and ret != SOAPY_SDR_CORRUPTION and ret != SOAPY_SDR_TIME_ERROR) return;
+        }
+    }
+
+    SoapySDR::DirectAccessRing ring;
+    const SoapySDR::AsyncStreamCallback callback;
+    const size_t numChans;
+    std::atomic<bool> running;
+    std::thread thread;
+};
+
+//! The default async streams of all devices, by stream
+static std::mutex &getAsyncStreamMutex(void)
+{
+    static std::mutex mutex;
+    return mutex;
+}
+
+static std::map<SoapySDR::Stream *, std::unique_ptr<AsyncStreamWorker>> &getAsyncStreams(void)
+{
+    static std::map<SoapySDR::Stream *, std::unique_ptr<AsyncStreamWorker>> streams;
+    return streams;
+}
+
+int SoapySDR::Device::startAsyncStream(Stream *stream, const AsyncStreamCallback &callback, const std::string &format, const size_t numChans, const size_t numBuffs)
+{
+    std::lock_guard<std::mutex> lock(getAsyncStreamMutex());
+    auto &streams = getAsyncStreams();
+    if (streams.count(stream) != 0) return SOAPY_SDR_STREAM_ERROR;
+    std::unique_ptr<AsyncStreamWorker> worker(new AsyncStreamWorker(this, stream, callback, format, numChans, numBuffs));
+    streams[stream] = std::move(worker);
+    return 0;
+}
+
+int SoapySDR::Device::stopAsyncStream(Stream *stream)
+{
+    //the worker is joined outside of the lock, the callback may take a while to return
+    std::unique_ptr<AsyncStreamWorker> worker;
+    {
+        std::lock_guard<std::mutex> lock(getAsyncStreamMutex());
+        auto &streams = getAsyncStreams();
+        auto it = streams.find(stream);
+        if (it == streams.end()) return SOAPY_SDR_STREAM_ERROR;
+        worker = std::move(it->second);
+        streams.erase(it);
+    }
+    worker.reset();
+    return 0;
+}
+
 /*******************************************************************
  * Direct buffer access API
  ******************************************************************/
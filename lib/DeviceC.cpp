@@ -220,6 +220,27 @@ int SoapySDRDevice_readStreamStatus(SoapySDRDevice *device, SoapySDRStream *stre
     __SOAPY_SDR_C_CATCH_RET(SOAPY_SDR_STREAM_ERROR);
 }
 
+/*******************************************************************
+ * Async stream API
+ ******************************************************************/
+int SoapySDRDevice_startAsyncStream(SoapySDRDevice *device, SoapySDRStream *stream, SoapySDRAsyncStreamCallback callback, void *userData, const char *format, const size_t numChans, const size_t numBuffs)
+{
+    __SOAPY_SDR_C_TRY
+    auto cppCallback = [callback, userData](const void * const *buffs, const int ret, const int flags, const long long timeNs)
+    {
+        callback(buffs, ret, flags, timeNs, userData);
+    };
+    return device->startAsyncStream(reinterpret_cast<SoapySDR::Stream *>(stream), cppCallback, format, numChans, numBuffs);
+    __SOAPY_SDR_C_CATCH_RET(SOAPY_SDR_STREAM_ERROR);
+}
+
+int SoapySDRDevice_stopAsyncStream(SoapySDRDevice *device, SoapySDRStream *stream)
+{
+    __SOAPY_SDR_C_TRY
+    return device->stopAsyncStream(reinterpret_cast<SoapySDR::Stream *>(stream));
+    __SOAPY_SDR_C_CATCH_RET(SOAPY_SDR_STREAM_ERROR);
+}
+
 /*******************************************************************
  * Direct buffer access API
  ******************************************************************/
@@ -0,0 +1,481 @@
+// Copyright (c) 2021-2021 Josh Blum
+// SPDX-License-Identifier: BSL-1.0
+
+#include <SoapySDR/DirectAccess.hpp>
+#include <SoapySDR/Formats.hpp>
+#include <SoapySDR/Time.hpp>
+#include <algorithm> //min
+#include <cstring> //memcpy
+#include <cstdint> //uintptr_t
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+/*******************************************************************
+ * Direct access reader
+ ******************************************************************/
+SoapySDR::DirectAccessReader::DirectAccessReader(
+    Device *device,
+    Stream *stream,
+    const size_t numChans,
+    const std::string &nativeFormat,
+    const std::string &format,
+    const double scaler):
+    _device(device),
+    _stream(stream),
+    _converting(format != nativeFormat or scaler != 1.0),
+    _elemSize(SoapySDR::formatToSize(nativeFormat)),
+    _rate(0.0),
+    _held(false),
+    _handle(0),
+    _buffs(numChans),
+    _offset(0),
+    _numElems(0),
+    _flags(0),
+    _timeNs(0)
+{
+    if (_converting) _converter = ConverterRegistry::Handle(nativeFormat, format, scaler);
+}
+
+SoapySDR::DirectAccessReader::~DirectAccessReader(void)
+{
+    this->reset();
+}
+
+void SoapySDR::DirectAccessReader::setSampleRate(const double rate)
+{
+    _rate = rate;
+}
+
+int SoapySDR::DirectAccessReader::readStream(
+    void * const *buffs,
+    const size_t numElems,
+    int &flags,
+    long long &timeNs,
+    const long timeoutUs)
+{
+    if (not _held)
+    {
+        const int ret = _device->acquireReadBuffer(_stream, _handle, _buffs.data(), _flags, _timeNs, timeoutUs);
+        if (ret <= 0)
+        {
+            if (ret == 0) _device->releaseReadBuffer(_stream, _handle);
+            flags = _flags;
+            timeNs = _timeNs;
+            return ret;
+        }
+        _held = true;
+        _offset = 0;
+        _numElems = size_t(ret);
+    }
+
+    const size_t numRead = std::min(numElems, _numElems-_offset);
+    for (size_t ch = 0; ch < _buffs.size(); ch++)
+    {
+        const auto *src = (const char *)_buffs[ch] + _offset*_elemSize;
+        if (_converting) _converter.convert(src, buffs[ch], numRead);
+        else std::memcpy(buffs[ch], src, numRead*_elemSize);
+    }
+
+    //the timestamp of a later fragment is advanced by the elements before it
+    flags = _flags;
+    timeNs = _timeNs;
+    if (_offset != 0 and (flags & SOAPY_SDR_HAS_TIME) != 0)
+    {
+        if (_rate > 0.0) timeNs += SoapySDR::ticksToTimeNs(_offset, _rate);
+        else flags &= ~SOAPY_SDR_HAS_TIME;
+    }
+
+    _offset += numRead;
+    if (_offset < _numElems)
+    {
+        flags |= SOAPY_SDR_MORE_FRAGMENTS;
+        flags &= ~SOAPY_SDR_END_BURST;
+    }
+    else this->reset();
+    return int(numRead);
+}
+
+void SoapySDR::DirectAccessReader::reset(void)
+{
+    if (not _held) return;
+    _held = false;
+    _device->releaseReadBuffer(_stream, _handle);
+}
+
+/*******************************************************************
+ * Direct access writer
+ ******************************************************************/
+SoapySDR::DirectAccessWriter::DirectAccessWriter(
+    Device *device,
+    Stream *stream,
+    const size_t numChans,
+    const std::string &nativeFormat,
+    const std::string &format,
+    const double scaler):
+    _device(device),
+    _stream(stream),
+    _converting(format != nativeFormat or scaler != 1.0),
+    _elemSize(SoapySDR::formatToSize(nativeFormat)),
+    _buffs(numChans)
+{
+    if (_converting) _converter = ConverterRegistry::Handle(format, nativeFormat, scaler);
+}
+
+int SoapySDR::DirectAccessWriter::writeStream(
+    const void * const *buffs,
+    const size_t numElems,
+    int &flags,
+    const long long timeNs,
+    const long timeoutUs)
+{
+    size_t handle(0);
+    const int ret = _device->acquireWriteBuffer(_stream, handle, _buffs.data(), timeoutUs);
+    if (ret < 0) return ret;
+
+    const size_t numWrite = std::min(numElems, size_t(ret));
+    for (size_t ch = 0; ch < _buffs.size(); ch++)
+    {
+        if (_converting) _converter.convert(buffs[ch], _buffs[ch], numWrite);
+        else std::memcpy(_buffs[ch], buffs[ch], numWrite*_elemSize);
+    }
+
+    //the end of burst belongs to the last element, which is not written in this call
+    if (numWrite < numElems) flags &= ~SOAPY_SDR_END_BURST;
+    _device->releaseWriteBuffer(_stream, handle, numWrite, flags, timeNs);
+    return int(numWrite);
+}
+
+/*******************************************************************
+ * Direct access ring
+ ******************************************************************/
+
+//! The alignment of each buffer, for vector loads and to not share cache lines
+static const size_t RING_ALIGNMENT = 64;
+
+//! The timeout of each stream call in the thread, so that stopping is noticed
+static const long RING_TIMEOUT_US = 100000;
+
+struct SoapySDR::DirectAccessRing::Impl
+{
+    Impl(Device *device, Stream *stream, const int direction, const size_t numChans, const size_t numBuffs, const size_t buffSize, const size_t elemSize);
+
+    void rxLoop(void);
+    void txLoop(void);
+    bool isRunning(void);
+    void start(void);
+    void stop(void);
+
+    //the meta data of each buffer, as returned by readStream() or given to writeStream()
+    struct Slot
+    {
+        std::vector<void *> buffs;
+        int ret;
+        int flags;
+        long long timeNs;
+    };
+
+    Device *device;
+    Stream *stream;
+    const int direction;
+    const size_t buffSize;
+    const size_t elemSize;
+    std::vector<char> pool;
+    std::vector<Slot> slots;
+
+    //the free buffers are owned by the producer, the ready buffers by the consumer
+    std::mutex mutex;
+    std::condition_variable cond;
+    std::deque<size_t> free, ready;
+    bool running;
+    int error;
+    std::thread thread;
+};
+
+SoapySDR::DirectAccessRing::Impl::Impl(Device *device, Stream *stream, const int direction, const size_t numChans, const size_t numBuffs, const size_t buffSize, const size_t elemSize):
+    device(device),
+    stream(stream),
+    direction(direction),
+    buffSize(buffSize),
+    elemSize(elemSize),
+    slots(numBuffs),
+    running(false),
+    error(0)
+{
+    const size_t chanBytes = (buffSize*elemSize + RING_ALIGNMENT-1) & ~(RING_ALIGNMENT-1);
+    pool.resize(numBuffs*numChans*chanBytes + RING_ALIGNMENT);
+    const size_t skew = size_t(reinterpret_cast<uintptr_t>(pool.data()) & (RING_ALIGNMENT-1));
+    char *base = pool.data() + ((RING_ALIGNMENT-skew) & (RING_ALIGNMENT-1));
+    for (size_t i = 0; i < numBuffs; i++)
+    {
+        for (size_t ch = 0; ch < numChans; ch++)
+        {
+            slots[i].buffs.push_back(base + (i*numChans+ch)*chanBytes);
+        }
+        free.push_back(i);
+    }
+}
+
+//! Can the stream continue after the error, such as after dropped samples?
+static bool isTransientError(const int ret)
+{
+    return ret == SOAPY_SDR_OVERFLOW or ret == SOAPY_SDR_CORRUPTION or ret == SOAPY_SDR_TIME_ERROR;
+}
+
+void SoapySDR::DirectAccessRing::Impl::rxLoop(void)
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true)
+    {
+        cond.wait(lock, [this]{return not running or not free.empty();});
+        if (not running) return;
+        const size_t i = free.front();
+        free.pop_front();
+
+        //the buffer is owned by the thread while it is filled
+        auto &slot = slots[i];
+        lock.unlock();
+        slot.flags = 0;
+        slot.timeNs = 0;
+        slot.ret = device->readStream(stream, slot.buffs.data(), buffSize, slot.flags, slot.timeNs, RING_TIMEOUT_US);
+        lock.lock();
+
+        //a fatal error stops the thread, so a failed stream is not polled in a loop
+        if (slot.ret < 0 and slot.ret != SOAPY_SDR_TIMEOUT and not isTransientError(slot.ret))
+        {
+            free.push_front(i);
+            error = slot.ret;
+            cond.notify_all();
+            return;
+        }
+        if (slot.ret == SOAPY_SDR_TIMEOUT) free.push_front(i);
+        else ready.push_back(i);
+        cond.notify_all();
+    }
+}
+
+void SoapySDR::DirectAccessRing::Impl::txLoop(void)
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true)
+    {
+        //the buffers which were released are written before stopping
+        cond.wait(lock, [this]{return not running or not ready.empty();});
+        if (ready.empty()) return;
+        const size_t i = ready.front();
+        ready.pop_front();
+
+        auto &slot = slots[i];
+        lock.unlock();
+        std::vector<const void *> buffs(slot.buffs.size());
+        int flags(slot.flags), ret(0);
+        for (size_t offset = 0; offset < size_t(slot.ret);)
+        {
+            for (size_t ch = 0; ch < buffs.size(); ch++) buffs[ch] = (const char *)slot.buffs[ch] + offset*elemSize;
+            int callFlags(flags);
+            ret = device->writeStream(stream, buffs.data(), size_t(slot.ret)-offset, callFlags, slot.timeNs, RING_TIMEOUT_US);
+            if ((ret == SOAPY_SDR_TIMEOUT or ret == 0) and this->isRunning()) continue;
+            if (ret <= 0) break;
+
+            //the rest of a partial write follows the written elements
+            offset += size_t(ret);
+            flags &= ~SOAPY_SDR_HAS_TIME;
+        }
+        lock.lock();
+
+        if (ret < 0) error = ret;
+        free.push_back(i);
+        cond.notify_all();
+    }
+}
+
+bool SoapySDR::DirectAccessRing::Impl::isRunning(void)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return running;
+}
+
+void SoapySDR::DirectAccessRing::Impl::start(void)
+{
+    this->stop();
+
+    //drop the buffers which were read before, they are from the last activation
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (direction == SOAPY_SDR_RX) while (not ready.empty())
+        {
+            free.push_back(ready.front());
+            ready.pop_front();
+        }
+        error = 0;
+        running = true;
+    }
+    if (direction == SOAPY_SDR_RX) thread = std::thread(&Impl::rxLoop, this);
+    else thread = std::thread(&Impl::txLoop, this);
+}
+
+void SoapySDR::DirectAccessRing::Impl::stop(void)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        running = false;
+        cond.notify_all();
+    }
+    if (thread.joinable()) thread.join();
+}
+
+SoapySDR::DirectAccessRing::DirectAccessRing(
+    Device *device,
+    Stream *stream,
+    const int direction,
+    const size_t numChans,
+    const std::string &format,
+    const size_t numBuffs,
+    const size_t buffSize):
+    _device(device),
+    _stream(stream),
+    _impl(nullptr)
+{
+    if (_device->getNumDirectAccessBuffers(_stream) != 0) return;
+    const size_t size = (buffSize == 0)?_device->getStreamMTU(_stream):buffSize;
+    _impl = new Impl(_device, _stream, direction, numChans, std::max<size_t>(numBuffs, 1), size, SoapySDR::formatToSize(format));
+}
+
+SoapySDR::DirectAccessRing::~DirectAccessRing(void)
+{
+    if (_impl == nullptr) return;
+    _impl->stop();
+    delete _impl;
+}
+
+bool SoapySDR::DirectAccessRing::isEmulated(void) const
+{
+    return _impl != nullptr;
+}
+
+int SoapySDR::DirectAccessRing::activateStream(const int flags, const long long timeNs, const size_t numElems)
+{
+    const int ret = _device->activateStream(_stream, flags, timeNs, numElems);
+    if (ret == 0) this->start();
+    return ret;
+}
+
+int SoapySDR::DirectAccessRing::deactivateStream(const int flags, const long long timeNs)
+{
+    this->stop();
+    return _device->deactivateStream(_stream, flags, timeNs);
+}
+
+void SoapySDR::DirectAccessRing::start(void)
+{
+    if (_impl != nullptr) _impl->start();
+}
+
+void SoapySDR::DirectAccessRing::stop(void)
+{
+    if (_impl != nullptr) _impl->stop();
+}
+
+size_t SoapySDR::DirectAccessRing::getNumDirectAccessBuffers(void)
+{
+    if (_impl == nullptr) return _device->getNumDirectAccessBuffers(_stream);
+    return _impl->slots.size();
+}
+
+int SoapySDR::DirectAccessRing::getDirectAccessBufferAddrs(const size_t handle, void **buffs)
+{
+    if (_impl == nullptr) return _device->getDirectAccessBufferAddrs(_stream, handle, buffs);
+    if (handle >= _impl->slots.size()) return SOAPY_SDR_NOT_SUPPORTED;
+    const auto &slot = _impl->slots[handle];
+    std::copy(slot.buffs.begin(), slot.buffs.end(), buffs);
+    return 0;
+}
+
+int SoapySDR::DirectAccessRing::acquireReadBuffer(
+    size_t &handle,
+    const void **buffs,
+    int &flags,
+    long long &timeNs,
+    const long timeoutUs)
+{
+    if (_impl == nullptr) return _device->acquireReadBuffer(_stream, handle, buffs, flags, timeNs, timeoutUs);
+
+    std::unique_lock<std::mutex> lock(_impl->mutex);
+    if (not _impl->cond.wait_for(lock, std::chrono::microseconds(timeoutUs), [this]{return not _impl->ready.empty() or _impl->error != 0;}))
+    {
+        return SOAPY_SDR_TIMEOUT;
+    }
+
+    //the fatal error which stopped the thread follows the buffers before it
+    if (_impl->ready.empty()) return _impl->error;
+    handle = _impl->ready.front();
+    _impl->ready.pop_front();
+
+    const auto &slot = _impl->slots[handle];
+    flags = slot.flags;
+    timeNs = slot.timeNs;
+
+    //an error has no buffer to hold
+    if (slot.ret < 0)
+    {
+        _impl->free.push_back(handle);
+        _impl->cond.notify_all();
+        return slot.ret;
+    }
+    std::copy(slot.buffs.begin(), slot.buffs.end(), buffs);
+    return slot.ret;
+}
+
+void SoapySDR::DirectAccessRing::releaseReadBuffer(const size_t handle)
+{
+    if (_impl == nullptr) return _device->releaseReadBuffer(_stream, handle);
+
+    std::lock_guard<std::mutex> lock(_impl->mutex);
+    _impl->free.push_back(handle);
+    _impl->cond.notify_all();
+}
+
+int SoapySDR::DirectAccessRing::acquireWriteBuffer(
+    size_t &handle,
+    void **buffs,
+    const long timeoutUs)
+{
+    if (_impl == nullptr) return _device->acquireWriteBuffer(_stream, handle, buffs, timeoutUs);
+
+    std::unique_lock<std::mutex> lock(_impl->mutex);
+    if (_impl->error != 0)
+    {
+        const int error = _impl->error;
+        _impl->error = 0;
+        return error;
+    }
+    if (not _impl->cond.wait_for(lock, std::chrono::microseconds(timeoutUs), [this]{return not _impl->free.empty();}))
+    {
+        return SOAPY_SDR_TIMEOUT;
+    }
+    handle = _impl->free.front();
+    _impl->free.pop_front();
+
+    const auto &slot = _impl->slots[handle];
+    std::copy(slot.buffs.begin(), slot.buffs.end(), buffs);
+    return int(_impl->buffSize);
+}
+
+void SoapySDR::DirectAccessRing::releaseWriteBuffer(
+    const size_t handle,
+    const size_t numElems,
+    int &flags,
+    const long long timeNs)
+{
+    if (_impl == nullptr) return _device->releaseWriteBuffer(_stream, handle, numElems, flags, timeNs);
+
+    std::lock_guard<std::mutex> lock(_impl->mutex);
+    auto &slot = _impl->slots[handle];
+    slot.ret = int(numElems);
+    slot.flags = flags;
+    slot.timeNs = timeNs;
+    _impl->ready.push_back(handle);
+    _impl->cond.notify_all();
+}
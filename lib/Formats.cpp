@@ -7,3 +7,13 @@ size_t SoapySDR::formatToSize(const std::string &format)
 {
     return SoapySDR_formatToSize(format.c_str());
 }
+
+SoapySDR::FormatDescriptor SoapySDR::formatToDescriptor(const std::string &format)
+{
+    return SoapySDR_formatToDescriptor(format.c_str());
+}
+
+SoapySDR::FormatDescriptor SoapySDR::formatIdToDescriptor(const unsigned id)
+{
+    return SoapySDR_formatIdToDescriptor(id);
+}
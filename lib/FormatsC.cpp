@@ -3,6 +3,61 @@
 
 #include <SoapySDR/Formats.h>
 #include <cctype>
+#include <cstring>
+#include <mutex>
+#include <deque>
+#include <string>
+#include <unordered_map>
+
+/***********************************************************************
+ * Interned formats
+ *
+ * Each format string is parsed once into a descriptor,
+ * the descriptor ID is its index in the table plus one.
+ * The deques keep the strings and the descriptors in place
+ * as the table grows, so the interned strings stay valid.
+ **********************************************************************/
+struct FormatTable
+{
+    std::mutex mutex;
+    std::deque<std::string> formats;
+    std::deque<SoapySDRFormatDescriptor> descriptors;
+    std::unordered_map<std::string, unsigned> ids;
+};
+
+static FormatTable &getFormatTable(void)
+{
+    static FormatTable table;
+    return table;
+}
+
+static SoapySDRFormatDescriptor emptyDescriptor(void)
+{
+    SoapySDRFormatDescriptor descriptor;
+    std::memset(&descriptor, 0, sizeof(descriptor));
+    descriptor.format = "";
+    return descriptor;
+}
+
+static SoapySDRFormatDescriptor parseDescriptor(const std::string &format)
+{
+    SoapySDRFormatDescriptor descriptor = emptyDescriptor();
+    descriptor.format = format.c_str();
+    descriptor.size = SoapySDR_formatToSize(format.c_str());
+    for (const char ch : format)
+    {
+        if (std::isdigit(ch)) descriptor.bitDepth = (descriptor.bitDepth*10) + size_t(ch-'0');
+    }
+
+    //the markup is an optional complex prefix, the type, the bits, and an optional byte order
+    descriptor.isComplex = format.front() == 'C';
+    const char type = (descriptor.isComplex and format.size() > 1)?format[1]:format[0];
+    descriptor.isFloat = type == 'F';
+    descriptor.isSigned = type == 'F' or type == 'S';
+    const std::string bigEndian(SOAPY_SDR_BIG_ENDIAN);
+    descriptor.isBigEndian = format.size() > bigEndian.size() and format.compare(format.size()-bigEndian.size(), bigEndian.size(), bigEndian) == 0;
+    return descriptor;
+}
 
 extern "C" {
 
@@ -20,4 +75,29 @@ size_t SoapySDR_formatToSize(const char *format)
     return size / 8; //bits to bytes
 }
 
+SoapySDRFormatDescriptor SoapySDR_formatToDescriptor(const char *format)
+{
+    if (format == nullptr or *format == '\0') return emptyDescriptor();
+
+    auto &table = getFormatTable();
+    std::lock_guard<std::mutex> lock(table.mutex);
+    const auto it = table.ids.find(format);
+    if (it != table.ids.end()) return table.descriptors[it->second-1];
+
+    table.formats.push_back(format);
+    table.descriptors.push_back(parseDescriptor(table.formats.back()));
+    auto &descriptor = table.descriptors.back();
+    descriptor.id = unsigned(table.descriptors.size());
+    table.ids[format] = descriptor.id;
+    return descriptor;
+}
+
+SoapySDRFormatDescriptor SoapySDR_formatIdToDescriptor(const unsigned id)
+{
+    auto &table = getFormatTable();
+    std::lock_guard<std::mutex> lock(table.mutex);
+    if (id == 0 or id > table.descriptors.size()) return emptyDescriptor();
+    return table.descriptors[id-1];
+}
+
 } //extern "C"
@@ -0,0 +1,1895 @@
+// Copyright (c) 2021-2021 Josh Blum
+// SPDX-License-Identifier: BSL-1.0
+
+#include "CPUFeatures.hpp"
+#include <SoapySDR/ConverterPrimitives.hpp>
+#include <SoapySDR/ConverterRegistry.hpp>
+#include <SoapySDR/Formats.hpp>
+#include <cstring> //memcpy
+#include <limits>
+#include <cmath> //sqrt
+#include <algorithm> //max
+
+#ifdef SOAPY_SDR_X86_DISPATCH
+#include <immintrin.h>
+
+#define SOAPY_SDR_SSE41 __attribute__((target("sse4.1")))
+#define SOAPY_SDR_AVX2 __attribute__((target("avx2")))
+#define SOAPY_SDR_AVX512 __attribute__((target("avx512f,avx512bw")))
+
+//the _mm512_undefined_*() values in the AVX-512 intrinsics of some GCC versions
+//trip -Wmaybe-uninitialized, so it is ignored around the AVX-512 kernels only
+#if defined(__clang__)
+#define SOAPY_SDR_AVX512_BEGIN
+#define SOAPY_SDR_AVX512_END
+#else
+#define SOAPY_SDR_AVX512_BEGIN \
+    _Pragma("GCC diagnostic push") \
+    _Pragma("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+#define SOAPY_SDR_AVX512_END \
+    _Pragma("GCC diagnostic pop")
+#endif
+
+/***********************************************************************
+ * The kernels operate on numElems*elemDepth scalar values so that
+ * the real and complex formats share a single implementation.
+ * A scalar loop with the conversion primitives handles the remainder.
+ **********************************************************************/
+
+/*!
+ * Convert float to int32 for the float to integer kernels.
+ * The saturating kernels round to nearest, the others truncate like the primitives.
+ * Both clamp the positive overflow which would otherwise convert to INT32_MIN,
+ * and the saturating packs clamp the rest, so out of range values clamp in every kernel.
+ * The clamp value is the first operand so that NaN passes through to INT32_MIN.
+ */
+template <bool saturate>
+static SOAPY_SDR_SSE41 inline __m128i sse41CvtPS(const __m128 in, const __m128 maxValue)
+{
+    const __m128 clamped = _mm_min_ps(maxValue, in);
+    return saturate?_mm_cvtps_epi32(clamped):_mm_cvttps_epi32(clamped);
+}
+
+template <bool saturate>
+static SOAPY_SDR_AVX2 inline __m256i avx2CvtPS(const __m256 in, const __m256 maxValue)
+{
+    const __m256 clamped = _mm256_min_ps(maxValue, in);
+    return saturate?_mm256_cvtps_epi32(clamped):_mm256_cvttps_epi32(clamped);
+}
+
+SOAPY_SDR_AVX512_BEGIN
+template <bool saturate>
+static SOAPY_SDR_AVX512 inline __m512i avx512CvtPS(const __m512 in, const __m512 maxValue)
+{
+    const __m512 clamped = _mm512_min_ps(maxValue, in);
+    return saturate?_mm512_cvtps_epi32(clamped):_mm512_cvttps_epi32(clamped);
+}
+SOAPY_SDR_AVX512_END
+
+/*!
+ * Store floats for the kernels which have a STREAMING variant.
+ * The streaming kernels align the output with a scalar loop first,
+ * store with non-temporal stores which bypass the cache, prefetch
+ * the input without polluting the cache, and fence before returning.
+ */
+static const size_t STREAM_PREFETCH_BYTES = 512;
+
+template <bool stream>
+static SOAPY_SDR_SSE41 inline void sse41StorePS(float *dst, const __m128 in)
+{
+    if (stream) _mm_stream_ps(dst, in);
+    else _mm_storeu_ps(dst, in);
+}
+
+template <bool stream>
+static SOAPY_SDR_AVX2 inline void avx2StorePS(float *dst, const __m256 in)
+{
+    if (stream) _mm256_stream_ps(dst, in);
+    else _mm256_storeu_ps(dst, in);
+}
+
+SOAPY_SDR_AVX512_BEGIN
+template <bool stream>
+static SOAPY_SDR_AVX512 inline void avx512StorePS(float *dst, const __m512 in)
+{
+    if (stream) _mm512_stream_ps(dst, in);
+    else _mm512_storeu_ps(dst, in);
+}
+SOAPY_SDR_AVX512_END
+
+//! Is the output aligned for the non-temporal stores of a vector type?
+template <typename VecType>
+static inline bool isStreamAligned(const float *dst)
+{
+    return (uintptr_t(dst) % sizeof(VecType)) == 0;
+}
+
+// S16 > F32 (the streaming kernels write with non-temporal stores)
+template <size_t elemDepth, bool stream>
+static SOAPY_SDR_SSE41 void sse41S16toF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+    const size_t n = numElems*elemDepth;
+    auto *src = (const int16_t *)srcBuff;
+    auto *dst = (float *)dstBuff;
+    const __m128 scale = _mm_set1_ps(float(scaler/SoapySDR::S16_FULL_SCALE));
+    size_t i = 0;
+    if (stream) for (; i < n and not isStreamAligned<__m128>(dst+i); i++) dst[i] = SoapySDR::S16toF32(src[i]) * scaler;
+    for (; i+8 <= n; i += 8)
+    {
+        if (stream) _mm_prefetch((const char *)(src+i) + STREAM_PREFETCH_BYTES, _MM_HINT_NTA);
+        const __m128i in = _mm_loadu_si128((const __m128i *)(src+i));
+        const __m128i lo = _mm_cvtepi16_epi32(in);
+        const __m128i hi = _mm_cvtepi16_epi32(_mm_unpackhi_epi64(in, in));
+        sse41StorePS<stream>(dst+i+0, _mm_mul_ps(_mm_cvtepi32_ps(lo), scale));
+        sse41StorePS<stream>(dst+i+4, _mm_mul_ps(_mm_cvtepi32_ps(hi), scale));
+    }
+    for (; i < n; i++) dst[i] = SoapySDR::S16toF32(src[i]) * scaler;
+    if (stream) _mm_sfence();
+}
+
+template <size_t elemDepth, bool stream>
+static SOAPY_SDR_AVX2 void avx2S16toF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+    const size_t n = numElems*elemDepth;
+    auto *src = (const int16_t *)srcBuff;
+    auto *dst = (float *)dstBuff;
+    const __m256 scale = _mm256_set1_ps(float(scaler/SoapySDR::S16_FULL_SCALE));
+    size_t i = 0;
+    if (stream) for (; i < n and not isStreamAligned<__m256>(dst+i); i++) dst[i] = SoapySDR::S16toF32(src[i]) * scaler;
+    for (; i+16 <= n; i += 16)
+    {
+        if (stream) _mm_prefetch((const char *)(src+i) + STREAM_PREFETCH_BYTES, _MM_HINT_NTA);
+        const __m256i in = _mm256_loadu_si256((const __m256i *)(src+i));
+        const __m256i lo = _mm256_cvtepi16_epi32(_mm256_castsi256_si128(in));
+        const __m256i hi = _mm256_cvtepi16_epi32(_mm256_extracti128_si256(in, 1));
+        avx2StorePS<stream>(dst+i+0, _mm256_mul_ps(_mm256_cvtepi32_ps(lo), scale));
+        avx2StorePS<stream>(dst+i+8, _mm256_mul_ps(_mm256_cvtepi32_ps(hi), scale));
+    }
+    for (; i < n; i++) dst[i] = SoapySDR::S16toF32(src[i]) * scaler;
+    if (stream) _mm_sfence();
+}
+
+SOAPY_SDR_AVX512_BEGIN
+template <size_t elemDepth, bool stream>
+static SOAPY_SDR_AVX512 void avx512S16toF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+    const size_t n = numElems*elemDepth;
+    auto *src = (const int16_t *)srcBuff;
+    auto *dst = (float *)dstBuff;
+    const __m512 scale = _mm512_set1_ps(float(scaler/SoapySDR::S16_FULL_SCALE));
+    size_t i = 0;
+    if (stream) for (; i < n and not isStreamAligned<__m512>(dst+i); i++) dst[i] = SoapySDR::S16toF32(src[i]) * scaler;
+    for (; i+32 <= n; i += 32)
+    {
+        if (stream) _mm_prefetch((const char *)(src+i) + STREAM_PREFETCH_BYTES, _MM_HINT_NTA);
+        const __m512i lo = _mm512_cvtepi16_epi32(_mm256_loadu_si256((const __m256i *)(src+i+0)));
+        const __m512i hi = _mm512_cvtepi16_epi32(_mm256_loadu_si256((const __m256i *)(src+i+16)));
+        avx512StorePS<stream>(dst+i+0, _mm512_mul_ps(_mm512_cvtepi32_ps(lo), scale));
+        avx512StorePS<stream>(dst+i+16, _mm512_mul_ps(_mm512_cvtepi32_ps(hi), scale));
+    }
+    for (; i < n; i++) dst[i] = SoapySDR::S16toF32(src[i]) * scaler;
+    if (stream) _mm_sfence();
+}
+SOAPY_SDR_AVX512_END
+
+// F32 > S16 (the saturating kernels round to nearest)
+template <size_t elemDepth, bool saturate>
+static SOAPY_SDR_SSE41 void sse41F32toS16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+    const size_t n = numElems*elemDepth;
+    auto *src = (const float *)srcBuff;
+    auto *dst = (int16_t *)dstBuff;
+    const __m128 scale = _mm_set1_ps(float(scaler));
+    const __m128 fullScale = _mm_set1_ps(SoapySDR::S16_FULL_SCALE);
+    const __m128 maxValue = _mm_set1_ps(INT16_MAX);
+    size_t i = 0;
+    for (; i+8 <= n; i += 8)
+    {
+        const __m128 in0 = _mm_mul_ps(_mm_mul_ps(_mm_loadu_ps(src+i+0), scale), fullScale);
+        const __m128 in1 = _mm_mul_ps(_mm_mul_ps(_mm_loadu_ps(src+i+4), scale), fullScale);
+        const __m128i out = _mm_packs_epi32(sse41CvtPS<saturate>(in0, maxValue), sse41CvtPS<saturate>(in1, maxValue));
+        _mm_storeu_si128((__m128i *)(dst+i), out);
+    }
+    for (; i < n; i++) dst[i] = saturate?SoapySDR::F32toS16Saturating(src[i] * scaler):SoapySDR::F32toS16(src[i] * scaler);
+}
+
+template <size_t elemDepth, bool saturate>
+static SOAPY_SDR_AVX2 void avx2F32toS16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+    const size_t n = numElems*elemDepth;
+    auto *src = (const float *)srcBuff;
+    auto *dst = (int16_t *)dstBuff;
+    const __m256 scale = _mm256_set1_ps(float(scaler));
+    const __m256 fullScale = _mm256_set1_ps(SoapySDR::S16_FULL_SCALE);
+    const __m256 maxValue = _mm256_set1_ps(INT16_MAX);
+    size_t i = 0;
+    for (; i+16 <= n; i += 16)
+    {
+        const __m256 in0 = _mm256_mul_ps(_mm256_mul_ps(_mm256_loadu_ps(src+i+0), scale), fullScale);
+        const __m256 in1 = _mm256_mul_ps(_mm256_mul_ps(_mm256_loadu_ps(src+i+8), scale), fullScale);
+        //packs operates per 128-bit lane, restore the sample order with a permute
+        const __m256i out = _mm256_packs_epi32(avx2CvtPS<saturate>(in0, maxValue), avx2CvtPS<saturate>(in1, maxValue));
+        _mm256_storeu_si256((__m256i *)(dst+i), _mm256_permute4x64_epi64(out, 0xd8));
+    }
+    for (; i < n; i++) dst[i] = saturate?SoapySDR::F32toS16Saturating(src[i] * scaler):SoapySDR::F32toS16(src[i] * scaler);
+}
+
+SOAPY_SDR_AVX512_BEGIN
+template <size_t elemDepth, bool saturate>
+static SOAPY_SDR_AVX512 void avx512F32toS16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+    const size_t n = numElems*elemDepth;
+    auto *src = (const float *)srcBuff;
+    auto *dst = (int16_t *)dstBuff;
+    const __m512 scale = _mm512_set1_ps(float(scaler));
+    const __m512 fullScale = _mm512_set1_ps(SoapySDR::S16_FULL_SCALE);
+    const __m512 maxValue = _mm512_set1_ps(INT16_MAX);
+    size_t i = 0;
+    for (; i+16 <= n; i += 16)
+    {
+        const __m512 in = _mm512_mul_ps(_mm512_mul_ps(_mm512_loadu_ps(src+i), scale), fullScale);
+        _mm256_storeu_si256((__m256i *)(dst+i), _mm512_cvtsepi32_epi16(avx512CvtPS<saturate>(in, maxValue)));
+    }
+    for (; i < n; i++) dst[i] = saturate?SoapySDR::F32toS16Saturating(src[i] * scaler):SoapySDR::F32toS16(src[i] * scaler);
+}
+SOAPY_SDR_AVX512_END
+
+// S8/U8 > F32 (the unsigned kernels remove the zero offset after widening)
+template <size_t elemDepth, bool isUnsigned, bool stream>
+static SOAPY_SDR_SSE41 void sse41I8toF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+    const size_t n = numElems*elemDepth;
+    auto *src = (const uint8_t *)srcBuff;
+    auto *dst = (float *)dstBuff;
+    const __m128 scale = _mm_set1_ps(float(scaler/SoapySDR::S8_FULL_SCALE));
+    const __m128i offset = _mm_set1_epi32(isUnsigned?SoapySDR::U8_ZERO_OFFSET:0);
+    size_t i = 0;
+    if (stream) for (; i < n and not isStreamAligned<__m128>(dst+i); i++) dst[i] = (isUnsigned?SoapySDR::U8toF32(src[i]):SoapySDR::S8toF32(int8_t(src[i]))) * scaler;
+    for (; i+16 <= n; i += 16)
+    {
+        if (stream) _mm_prefetch((const char *)(src+i) + STREAM_PREFETCH_BYTES, _MM_HINT_NTA);
+        __m128i in = _mm_loadu_si128((const __m128i *)(src+i));
+        for (size_t j = 0; j < 16; j += 4)
+        {
+            const __m128i wide = isUnsigned?_mm_sub_epi32(_mm_cvtepu8_epi32(in), offset):_mm_cvtepi8_epi32(in);
+            sse41StorePS<stream>(dst+i+j, _mm_mul_ps(_mm_cvtepi32_ps(wide), scale));
+            in = _mm_srli_si128(in, 4);
+        }
+    }
+    for (; i < n; i++) dst[i] = (isUnsigned?SoapySDR::U8toF32(src[i]):SoapySDR::S8toF32(int8_t(src[i]))) * scaler;
+    if (stream) _mm_sfence();
+}
+
+template <size_t elemDepth, bool isUnsigned, bool stream>
+static SOAPY_SDR_AVX2 void avx2I8toF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+    const size_t n = numElems*elemDepth;
+    auto *src = (const uint8_t *)srcBuff;
+    auto *dst = (float *)dstBuff;
+    const __m256 scale = _mm256_set1_ps(float(scaler/SoapySDR::S8_FULL_SCALE));
+    const __m256i offset = _mm256_set1_epi32(isUnsigned?SoapySDR::U8_ZERO_OFFSET:0);
+    size_t i = 0;
+    if (stream) for (; i < n and not isStreamAligned<__m256>(dst+i); i++) dst[i] = (isUnsigned?SoapySDR::U8toF32(src[i]):SoapySDR::S8toF32(int8_t(src[i]))) * scaler;
+    for (; i+16 <= n; i += 16)
+    {
+        if (stream) _mm_prefetch((const char *)(src+i) + STREAM_PREFETCH_BYTES, _MM_HINT_NTA);
+        const __m128i in = _mm_loadu_si128((const __m128i *)(src+i));
+        const __m128i inHi = _mm_unpackhi_epi64(in, in);
+        const __m256i lo = isUnsigned?_mm256_sub_epi32(_mm256_cvtepu8_epi32(in), offset):_mm256_cvtepi8_epi32(in);
+        const __m256i hi = isUnsigned?_mm256_sub_epi32(_mm256_cvtepu8_epi32(inHi), offset):_mm256_cvtepi8_epi32(inHi);
+        avx2StorePS<stream>(dst+i+0, _mm256_mul_ps(_mm256_cvtepi32_ps(lo), scale));
+        avx2StorePS<stream>(dst+i+8, _mm256_mul_ps(_mm256_cvtepi32_ps(hi), scale));
+    }
+    for (; i < n; i++) dst[i] = (isUnsigned?SoapySDR::U8toF32(src[i]):SoapySDR::S8toF32(int8_t(src[i]))) * scaler;
+    if (stream) _mm_sfence();
+}
+
+SOAPY_SDR_AVX512_BEGIN
+template <size_t elemDepth, bool isUnsigned, bool stream>
+static SOAPY_SDR_AVX512 void avx512I8toF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+    const size_t n = numElems*elemDepth;
+    auto *src = (const uint8_t *)srcBuff;
+    auto *dst = (float *)dstBuff;
+    const __m512 scale = _mm512_set1_ps(float(scaler/SoapySDR::S8_FULL_SCALE));
+    const __m512i offset = _mm512_set1_epi32(isUnsigned?SoapySDR::U8_ZERO_OFFSET:0);
+    size_t i = 0;
+    if (stream) for (; i < n and not isStreamAligned<__m512>(dst+i); i++) dst[i] = (isUnsigned?SoapySDR::U8toF32(src[i]):SoapySDR::S8toF32(int8_t(src[i]))) * scaler;
+    for (; i+32 <= n; i += 32)
+    {
+        if (stream) _mm_prefetch((const char *)(src+i) + STREAM_PREFETCH_BYTES, _MM_HINT_NTA);
+        const __m128i in0 = _mm_loadu_si128((const __m128i *)(src+i+0));
+        const __m128i in1 = _mm_loadu_si128((const __m128i *)(src+i+16));
+        const __m512i lo = isUnsigned?_mm512_sub_epi32(_mm512_cvtepu8_epi32(in0), offset):_mm512_cvtepi8_epi32(in0);
+        const __m512i hi = isUnsigned?_mm512_sub_epi32(_mm512_cvtepu8_epi32(in1), offset):_mm512_cvtepi8_epi32(in1);
+        avx512StorePS<stream>(dst+i+0, _mm512_mul_ps(_mm512_cvtepi32_ps(lo), scale));
+        avx512StorePS<stream>(dst+i+16, _mm512_mul_ps(_mm512_cvtepi32_ps(hi), scale));
+    }
+    for (; i < n; i++) dst[i] = (isUnsigned?SoapySDR::U8toF32(src[i]):SoapySDR::S8toF32(int8_t(src[i]))) * scaler;
+    if (stream) _mm_sfence();
+}
+SOAPY_SDR_AVX512_END
+
+// F32 > S8/U8 (the unsigned kernels flip the sign bit to add the zero offset)
+template <size_t elemDepth, bool isUnsigned, bool saturate>
+static SOAPY_SDR_SSE41 void sse41F32toI8(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+    const size_t n = numElems*elemDepth;
+    auto *src = (const float *)srcBuff;
+    auto *dst = (uint8_t *)dstBuff;
+    const __m128 scale = _mm_set1_ps(float(scaler));
+    const __m128 fullScale = _mm_set1_ps(SoapySDR::S8_FULL_SCALE);
+    const __m128 maxValue = _mm_set1_ps(INT8_MAX);
+    const __m128i offset = _mm_set1_epi8(isUnsigned?char(SoapySDR::U8_ZERO_OFFSET):0);
+    size_t i = 0;
+    for (; i+16 <= n; i += 16)
+    {
+        __m128i in[4];
+        for (size_t j = 0; j < 4; j++)
+        {
+            const __m128 x = _mm_mul_ps(_mm_mul_ps(_mm_loadu_ps(src+i+j*4), scale), fullScale);
+            in[j] = sse41CvtPS<saturate>(x, maxValue);
+        }
+        const __m128i out = _mm_packs_epi16(_mm_packs_epi32(in[0], in[1]), _mm_packs_epi32(in[2], in[3]));
+        _mm_storeu_si128((__m128i *)(dst+i), _mm_xor_si128(out, offset));
+    }
+    for (; i < n; i++)
+    {
+        if (saturate) dst[i] = isUnsigned?SoapySDR::F32toU8Saturating(src[i] * scaler):uint8_t(SoapySDR::F32toS8Saturating(src[i] * scaler));
+        else dst[i] = isUnsigned?SoapySDR::F32toU8(src[i] * scaler):uint8_t(SoapySDR::F32toS8(src[i] * scaler));
+    }
+}
+
+template <size_t elemDepth, bool isUnsigned, bool saturate>
+static SOAPY_SDR_AVX2 void avx2F32toI8(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+    const size_t n = numElems*elemDepth;
+    auto *src = (const float *)srcBuff;
+    auto *dst = (uint8_t *)dstBuff;
+    const __m256 scale = _mm256_set1_ps(float(scaler));
+    const __m256 fullScale = _mm256_set1_ps(SoapySDR::S8_FULL_SCALE);
+    const __m256 maxValue = _mm256_set1_ps(INT8_MAX);
+    const __m256i offset = _mm256_set1_epi8(isUnsigned?char(SoapySDR::U8_ZERO_OFFSET):0);
+    //packs operates per 128-bit lane, restore the sample order with a permute
+    const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+    size_t i = 0;
+    for (; i+32 <= n; i += 32)
+    {
+        __m256i in[4];
+        for (size_t j = 0; j < 4; j++)
+        {
+            const __m256 x = _mm256_mul_ps(_mm256_mul_ps(_mm256_loadu_ps(src+i+j*8), scale), fullScale);
+            in[j] = avx2CvtPS<saturate>(x, maxValue);
+        }
+        const __m256i out = _mm256_packs_epi16(_mm256_packs_epi32(in[0], in[1]), _mm256_packs_epi32(in[2], in[3]));
+        _mm256_storeu_si256((__m256i *)(dst+i), _mm256_xor_si256(_mm256_permutevar8x32_epi32(out, order), offset));
+    }
+    for (; i < n; i++)
+    {
+        if (saturate) dst[i] = isUnsigned?SoapySDR::F32toU8Saturating(src[i] * scaler):uint8_t(SoapySDR::F32toS8Saturating(src[i] * scaler));
+        else dst[i] = isUnsigned?SoapySDR::F32toU8(src[i] * scaler):uint8_t(SoapySDR::F32toS8(src[i] * scaler));
+    }
+}
+
+SOAPY_SDR_AVX512_BEGIN
+template <size_t elemDepth, bool isUnsigned, bool saturate>
+static SOAPY_SDR_AVX512 void avx512F32toI8(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+    const size_t n = numElems*elemDepth;
+    auto *src = (const float *)srcBuff;
+    auto *dst = (uint8_t *)dstBuff;
+    const __m512 scale = _mm512_set1_ps(float(scaler));
+    const __m512 fullScale = _mm512_set1_ps(SoapySDR::S8_FULL_SCALE);
+    const __m512 maxValue = _mm512_set1_ps(INT8_MAX);
+    const __m128i offset = _mm_set1_epi8(isUnsigned?char(SoapySDR::U8_ZERO_OFFSET):0);
+    size_t i = 0;
+    for (; i+16 <= n; i += 16)
+    {
+        const __m512 x = _mm512_mul_ps(_mm512_mul_ps(_mm512_loadu_ps(src+i), scale), fullScale);
+        const __m128i out = _mm512_cvtsepi32_epi8(avx512CvtPS<saturate>(x, maxValue));
+        _mm_storeu_si128((__m128i *)(dst+i), _mm_xor_si128(out, offset));
+    }
+    for (; i < n; i++)
+    {
+        if (saturate) dst[i] = isUnsigned?SoapySDR::F32toU8Saturating(src[i] * scaler):uint8_t(SoapySDR::F32toS8Saturating(src[i] * scaler));
+        else dst[i] = isUnsigned?SoapySDR::F32toU8(src[i] * scaler):uint8_t(SoapySDR::F32toS8(src[i] * scaler));
+    }
+}
+SOAPY_SDR_AVX512_END
+
+/***********************************************************************
+ * Packed complex formats: CS12 and CS4
+ * The integer to integer kernels only vectorize the unit scaler,
+ * other scalers fall back to the scalar loop with the primitives.
+ **********************************************************************/
+
+//! Unpack 4 CS12 samples into 8 MSB aligned int16 (reads 16 bytes)
+static SOAPY_SDR_SSE41 inline __m128i sse41UnpackCS12(const uint8_t *src)
+{
+    const __m128i order = _mm_setr_epi8(0, 1, 1, 2, 3, 4, 4, 5, 6, 7, 7, 8, 9, 10, 10, 11);
+    const __m128i in = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)src), order);
+    //I is the low 12 bits of the even words, Q is the high 12 bits of the odd words
+    return _mm_blend_epi16(_mm_slli_epi16(in, 4), _mm_and_si128(in, _mm_set1_epi16(int16_t(0xfff0))), 0xaa);
+}
+
+//! Unpack 8 CS12 samples into 16 MSB aligned int16 (reads 28 bytes)
+static SOAPY_SDR_AVX2 inline __m256i avx2UnpackCS12(const uint8_t *src)
+{
+    const __m256i order = _mm256_setr_epi8(
+        0, 1, 1, 2, 3, 4, 4, 5, 6, 7, 7, 8, 9, 10, 10, 11,
+        0, 1, 1, 2, 3, 4, 4, 5, 6, 7, 7, 8, 9, 10, 10, 11);
+    const __m256i in = _mm256_shuffle_epi8(_mm256_inserti128_si256(_mm256_castsi128_si256(
+        _mm_loadu_si128((const __m128i *)(src+0))), _mm_loadu_si128((const __m128i *)(src+12)), 1), order);
+    return _mm256_blend_epi16(_mm256_slli_epi16(in, 4), _mm256_and_si256(in, _mm256_set1_epi16(int16_t(0xfff0))), 0xaa);
+}
+
+//! Pack 8 int16 into 4 CS12 samples (writes 12 bytes)
+static SOAPY_SDR_SSE41 inline void sse41PackCS12(const __m128i in, uint8_t *dst)
+{
+    const __m128i lo = _mm_setr_epi8(0, 1, 3, 4, 5, 7, 8, 9, 11, 12, 13, 15, -1, -1, -1, -1);
+    const __m128i mid = _mm_setr_epi8(-1, 2, -1, -1, 6, -1, -1, 10, -1, -1, 14, -1, -1, -1, -1, -1);
+    //even words hold I >> 4, odd words hold Q with the low nibble cleared
+    const __m128i w = _mm_blend_epi16(_mm_srli_epi16(in, 4), _mm_and_si128(in, _mm_set1_epi16(int16_t(0xfff0))), 0xaa);
+    const __m128i out = _mm_or_si128(_mm_shuffle_epi8(w, lo), _mm_shuffle_epi8(w, mid));
+    _mm_storel_epi64((__m128i *)dst, out);
+    const int32_t last = _mm_extract_epi32(out, 2);
+    std::memcpy(dst+8, &last, sizeof(last));
+}
+
+// CS12 > CS16
+static SOAPY_SDR_SSE41 void sse41CS12toCS16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+    auto *src = (const uint8_t *)srcBuff;
+    auto *dst = (int16_t *)dstBuff;
+    size_t i = 0;
+    if (scaler == 1.0) for (; i+6 <= numElems; i += 4)
+    {
+        _mm_storeu_si128((__m128i *)(dst+i*2), sse41UnpackCS12(src+i*3));
+    }
+    for (; i < numElems; i++)
+    {
+        int16_t tmp[2];
+        SoapySDR::CS12toCS16(src+i*3, tmp);
+        dst[i*2+0] = tmp[0] * scaler;
+        dst[i*2+1] = tmp[1] * scaler;
+    }
+}
+
+static SOAPY_SDR_AVX2 void avx2CS12toCS16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+    auto *src = (const uint8_t *)srcBuff;
+    auto *dst = (int16_t *)dstBuff;
+    size_t i = 0;
+    if (scaler == 1.0) for (; i+10 <= numElems; i += 8)
+    {
+        _mm256_storeu_si256((__m256i *)(dst+i*2), avx2UnpackCS12(src+i*3));
+    }
+    for (; i < numElems; i++)
+    {
+        int16_t tmp[2];
+        SoapySDR::CS12toCS16(src+i*3, tmp);
+        dst[i*2+0] = tmp[0] * scaler;
+        dst[i*2+1] = tmp[1] * scaler;
+    }
+}
+
+// CS16 > CS12
+static SOAPY_SDR_SSE41 void sse41CS16toCS12(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+    auto *src = (const int16_t *)srcBuff;
+    auto *dst = (uint8_t *)dstBuff;
+    size_t i = 0;
+    if (scaler == 1.0) for (; i+4 <= numElems; i += 4)
+    {
+        sse41PackCS12(_mm_loadu_si128((const __m128i *)(src+i*2)), dst+i*3);
+    }
+    for (; i < numElems; i++)
+    {
+        const int16_t tmp[2] = {int16_t(src[i*2+0] * scaler), int16_t(src[i*2+1] * scaler)};
+        SoapySDR::CS16toCS12(tmp, dst+i*3);
+    }
+}
+
+// CS12 > CF32
+static SOAPY_SDR_SSE41 void sse41CS12toCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+    auto *src = (const uint8_t *)srcBuff;
+    auto *dst = (float *)dstBuff;
+    const __m128 scale = _mm_set1_ps(float(scaler/SoapySDR::S16_FULL_SCALE));
+    size_t i = 0;
+    for (; i+6 <= numElems; i += 4)
+    {
+        const __m128i in = sse41UnpackCS12(src+i*3);
+        const __m128i lo = _mm_cvtepi16_epi32(in);
+        const __m128i hi = _mm_cvtepi16_epi32(_mm_unpackhi_epi64(in, in));
+        _mm_storeu_ps(dst+i*2+0, _mm_mul_ps(_mm_cvtepi32_ps(lo), scale));
+        _mm_storeu_ps(dst+i*2+4, _mm_mul_ps(_mm_cvtepi32_ps(hi), scale));
+    }
+    for (; i < numElems; i++)
+    {
+        int16_t tmp[2];
+        SoapySDR::CS12toCS16(src+i*3, tmp);
+        dst[i*2+0] = SoapySDR::S16toF32(tmp[0]) * scaler;
+        dst[i*2+1] = SoapySDR::S16toF32(tmp[1]) * scaler;
+    }
+}
+
+static SOAPY_SDR_AVX2 void avx2CS12toCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+    auto *src = (const uint8_t *)srcBuff;
+    auto *dst = (float *)dstBuff;
+    const __m256 scale = _mm256_set1_ps(float(scaler/SoapySDR::S16_FULL_SCALE));
+    size_t i = 0;
+    for (; i+10 <= numElems; i += 8)
+    {
+        const __m256i in = avx2UnpackCS12(src+i*3);
+        const __m256i lo = _mm256_cvtepi16_epi32(_mm256_castsi256_si128(in));
+        const __m256i hi = _mm256_cvtepi16_epi32(_mm256_extracti128_si256(in, 1));
+        _mm256_storeu_ps(dst+i*2+0, _mm256_mul_ps(_mm256_cvtepi32_ps(lo), scale));
+        _mm256_storeu_ps(dst+i*2+8, _mm256_mul_ps(_mm256_cvtepi32_ps(hi), scale));
+    }
+    for (; i < numElems; i++)
+    {
+        int16_t tmp[2];
+        SoapySDR::CS12toCS16(src+i*3, tmp);
+        dst[i*2+0] = SoapySDR::S16toF32(tmp[0]) * scaler;
+        dst[i*2+1] = SoapySDR::S16toF32(tmp[1]) * scaler;
+    }
+}
+
+SOAPY_SDR_AVX512_BEGIN
+static SOAPY_SDR_AVX512 void avx512CS12toCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+    auto *src = (const uint8_t *)srcBuff;
+    auto *dst = (float *)dstBuff;
+    const __m512 scale = _mm512_set1_ps(float(scaler/SoapySDR::S16_FULL_SCALE));
+    size_t i = 0;
+    for (; i+10 <= numElems; i += 8)
+    {
+        const __m512i in = _mm512_cvtepi16_epi32(avx2UnpackCS12(src+i*3));
+        _mm512_storeu_ps(dst+i*2, _mm512_mul_ps(_mm512_cvtepi32_ps(in), scale));
+    }
+    for (; i < numElems; i++)
+    {
+        int16_t tmp[2];
+        SoapySDR::CS12toCS16(src+i*3, tmp);
+        dst[i*2+0] = SoapySDR::S16toF32(tmp[0]) * scaler;
+        dst[i*2+1] = SoapySDR::S16toF32(tmp[1]) * scaler;
+    }
+}
+SOAPY_SDR_AVX512_END
+
+//! Clamp 8 int16 holding 12-bit values to the negative limit, and MSB align them for packing
+static SOAPY_SDR_SSE41 inline __m128i sse41AlignS12(const __m128i in)
+{
+    return _mm_slli_epi16(_mm_max_epi16(in, _mm_set1_epi16(-2048)), 4);
+}
+
+// CF32 > CS12 (the saturating kernels round and clamp to 12 bits before packing)
+template <bool saturate>
+static SOAPY_SDR_SSE41 void sse41CF32toCS12(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+    auto *src = (const float *)srcBuff;
+    auto *dst = (uint8_t *)dstBuff;
+    const __m128 scale = _mm_set1_ps(float(scaler));
+    const __m128 fullScale = _mm_set1_ps(saturate?(SoapySDR::S16_FULL_SCALE >> 4):SoapySDR::S16_FULL_SCALE);
+    const __m128 maxValue = _mm_set1_ps(saturate?2047:INT16_MAX);
+    size_t i = 0;
+    for (; i+4 <= numElems; i += 4)
+    {
+        const __m128 in0 = _mm_mul_ps(_mm_mul_ps(_mm_loadu_ps(src+i*2+0), scale), fullScale);
+        const __m128 in1 = _mm_mul_ps(_mm_mul_ps(_mm_loadu_ps(src+i*2+4), scale), fullScale);
+        const __m128i out = _mm_packs_epi32(sse41CvtPS<saturate>(in0, maxValue), sse41CvtPS<saturate>(in1, maxValue));
+        sse41PackCS12(saturate?sse41AlignS12(out):out, dst+i*3);
+    }
+    for (; i < numElems; i++)
+    {
+        if (saturate)
+        {
+            const float tmp[2] = {float(src[i*2+0] * scaler), float(src[i*2+1] * scaler)};
+            SoapySDR::CF32toCS12Saturating(tmp, dst+i*3);
+            continue;
+        }
+        const int16_t tmp[2] = {SoapySDR::F32toS16(src[i*2+0] * scaler), SoapySDR::F32toS16(src[i*2+1] * scaler)};
+        SoapySDR::CS16toCS12(tmp, dst+i*3);
+    }
+}
+
+template <bool saturate>
+static SOAPY_SDR_AVX2 void avx2CF32toCS12(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+    auto *src = (const float *)srcBuff;
+    auto *dst = (uint8_t *)dstBuff;
+    const __m256 scale = _mm256_set1_ps(float(scaler));
+    const __m256 fullScale = _mm256_set1_ps(saturate?(SoapySDR::S16_FULL_SCALE >> 4):SoapySDR::S16_FULL_SCALE);
+    const __m256 maxValue = _mm256_set1_ps(saturate?2047:INT16_MAX);
+    size_t i = 0;
+    for (; i+8 <= numElems; i += 8)
+    {
+        const __m256 in0 = _mm256_mul_ps(_mm256_mul_ps(_mm256_loadu_ps(src+i*2+0), scale), fullScale);
+        const __m256 in1 = _mm256_mul_ps(_mm256_mul_ps(_mm256_loadu_ps(src+i*2+8), scale), fullScale);
+        const __m256i out = _mm256_permute4x64_epi64(_mm256_packs_epi32(avx2CvtPS<saturate>(in0, maxValue), avx2CvtPS<saturate>(in1, maxValue)), 0xd8);
+        sse41PackCS12(saturate?sse41AlignS12(_mm256_castsi256_si128(out)):_mm256_castsi256_si128(out), dst+i*3+0);
+        sse41PackCS12(saturate?sse41AlignS12(_mm256_extracti128_si256(out, 1)):_mm256_extracti128_si256(out, 1), dst+i*3+12);
+    }
+    for (; i < numElems; i++)
+    {
+        if (saturate)
+        {
+            const float tmp[2] = {float(src[i*2+0] * scaler), float(src[i*2+1] * scaler)};
+            SoapySDR::CF32toCS12Saturating(tmp, dst+i*3);
+            continue;
+        }
+        const int16_t tmp[2] = {SoapySDR::F32toS16(src[i*2+0] * scaler), SoapySDR::F32toS16(src[i*2+1] * scaler)};
+        SoapySDR::CS16toCS12(tmp, dst+i*3);
+    }
+}
+
+SOAPY_SDR_AVX512_BEGIN
+template <bool saturate>
+static SOAPY_SDR_AVX512 void avx512CF32toCS12(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+    auto *src = (const float *)srcBuff;
+    auto *dst = (uint8_t *)dstBuff;
+    const __m512 scale = _mm512_set1_ps(float(scaler));
+    const __m512 fullScale = _mm512_set1_ps(saturate?(SoapySDR::S16_FULL_SCALE >> 4):SoapySDR::S16_FULL_SCALE);
+    const __m512 maxValue = _mm512_set1_ps(saturate?2047:INT16_MAX);
+    size_t i = 0;
+    for (; i+8 <= numElems; i += 8)
+    {
+        const __m512 in = _mm512_mul_ps(_mm512_mul_ps(_mm512_loadu_ps(src+i*2), scale), fullScale);
+        const __m256i out = _mm512_cvtsepi32_epi16(avx512CvtPS<saturate>(in, maxValue));
+        sse41PackCS12(saturate?sse41AlignS12(_mm256_castsi256_si128(out)):_mm256_castsi256_si128(out), dst+i*3+0);
+        sse41PackCS12(saturate?sse41AlignS12(_mm256_extracti128_si256(out, 1)):_mm256_extracti128_si256(out, 1), dst+i*3+12);
+    }
+    for (; i < numElems; i++)
+    {
+        if (saturate)
+        {
+            const float tmp[2] = {float(src[i*2+0] * scaler), float(src[i*2+1] * scaler)};
+            SoapySDR::CF32toCS12Saturating(tmp, dst+i*3);
+            continue;
+        }
+        const int16_t tmp[2] = {SoapySDR::F32toS16(src[i*2+0] * scaler), SoapySDR::F32toS16(src[i*2+1] * scaler)};
+        SoapySDR::CS16toCS12(tmp, dst+i*3);
+    }
+}
+SOAPY_SDR_AVX512_END
+
+//! Unpack 8 CS4 samples into 16 MSB aligned int8
+static SOAPY_SDR_SSE41 inline __m128i sse41UnpackCS4(const __m128i in)
+{
+    const __m128i nibble = _mm_set1_epi8(char(0xf0));
+    return _mm_unpacklo_epi8(_mm_and_si128(_mm_slli_epi16(in, 4), nibble), _mm_and_si128(in, nibble));
+}
+
+//! Pack 16 int8 (8 samples per 128-bit lane) into the low byte of each 16-bit word
+static SOAPY_SDR_AVX2 inline __m256i avx2PackCS4(const __m256i in)
+{
+    return _mm256_or_si256(
+        _mm256_and_si256(_mm256_srli_epi16(in, 4), _mm256_set1_epi16(0x000f)),
+        _mm256_and_si256(_mm256_srli_epi16(in, 8), _mm256_set1_epi16(0x00f0)));
+}
+
+static SOAPY_SDR_SSE41 inline __m128i sse41PackCS4(const __m128i in)
+{
+    return _mm_or_si128(
+        _mm_and_si128(_mm_srli_epi16(in, 4), _mm_set1_epi16(0x000f)),
+        _mm_and_si128(_mm_srli_epi16(in, 8), _mm_set1_epi16(0x00f0)));
+}
+
+// CS4 > CS8
+static SOAPY_SDR_SSE41 void sse41CS4toCS8(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+    auto *src = (const uint8_t *)srcBuff;
+    auto *dst = (int8_t *)dstBuff;
+    size_t i = 0;
+    if (scaler == 1.0) for (; i+16 <= numElems; i += 16)
+    {
+        const __m128i in = _mm_loadu_si128((const __m128i *)(src+i));
+        _mm_storeu_si128((__m128i *)(dst+i*2+0), sse41UnpackCS4(in));
+        _mm_storeu_si128((__m128i *)(dst+i*2+16), sse41UnpackCS4(_mm_unpackhi_epi64(in, in)));
+    }
+    for (; i < numElems; i++)
+    {
+        int8_t tmp[2];
+        SoapySDR::CS4toCS8(src[i], tmp);
+        dst[i*2+0] = tmp[0] * scaler;
+        dst[i*2+1] = tmp[1] * scaler;
+    }
+}
+
+// CS8 > CS4
+static SOAPY_SDR_SSE41 void sse41CS8toCS4(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+    auto *src = (const int8_t *)srcBuff;
+    auto *dst = (uint8_t *)dstBuff;
+    size_t i = 0;
+    if (scaler == 1.0) for (; i+16 <= numElems; i += 16)
+    {
+        const __m128i in0 = sse41PackCS4(_mm_loadu_si128((const __m128i *)(src+i*2+0)));
+        const __m128i in1 = sse41PackCS4(_mm_loadu_si128((const __m128i *)(src+i*2+16)));
+        _mm_storeu_si128((__m128i *)(dst+i), _mm_packus_epi16(in0, in1));
+    }
+    for (; i < numElems; i++)
+    {
+        const int8_t tmp[2] = {int8_t(src[i*2+0] * scaler), int8_t(src[i*2+1] * scaler)};
+        dst[i] = SoapySDR::CS8toCS4(tmp);
+    }
+}
+
+static SOAPY_SDR_AVX2 void avx2CS8toCS4(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+    auto *src = (const int8_t *)srcBuff;
+    auto *dst = (uint8_t *)dstBuff;
+    size_t i = 0;
+    if (scaler == 1.0) for (; i+32 <= numElems; i += 32)
+    {
+        const __m256i in0 = avx2PackCS4(_mm256_loadu_si256((const __m256i *)(src+i*2+0)));
+        const __m256i in1 = avx2PackCS4(_mm256_loadu_si256((const __m256i *)(src+i*2+32)));
+        //packus operates per 128-bit lane, restore the sample order with a permute
+        _mm256_storeu_si256((__m256i *)(dst+i), _mm256_permute4x64_epi64(_mm256_packus_epi16(in0, in1), 0xd8));
+    }
+    for (; i < numElems; i++)
+    {
+        const int8_t tmp[2] = {int8_t(src[i*2+0] * scaler), int8_t(src[i*2+1] * scaler)};
+        dst[i] = SoapySDR::CS8toCS4(tmp);
+    }
+}
+
+// CS4 > CF32
+static SOAPY_SDR_SSE41 void sse41CS4toCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+    auto *src = (const uint8_t *)srcBuff;
+    auto *dst = (float *)dstBuff;
+    const __m128 scale = _mm_set1_ps(float(scaler/SoapySDR::S8_FULL_SCALE));
+    size_t i = 0;
+    for (; i+8 <= numElems; i += 8)
+    {
+        __m128i in = sse41UnpackCS4(_mm_loadl_epi64((const __m128i *)(src+i)));
+        for (size_t j = 0; j < 16; j += 4)
+        {
+            _mm_storeu_ps(dst+i*2+j, _mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepi8_epi32(in)), scale));
+            in = _mm_srli_si128(in, 4);
+        }
+    }
+    for (; i < numElems; i++)
+    {
+        int8_t tmp[2];
+        SoapySDR::CS4toCS8(src[i], tmp);
+        dst[i*2+0] = SoapySDR::S8toF32(tmp[0]) * scaler;
+        dst[i*2+1] = SoapySDR::S8toF32(tmp[1]) * scaler;
+    }
+}
+
+static SOAPY_SDR_AVX2 void avx2CS4toCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+    auto *src = (const uint8_t *)srcBuff;
+    auto *dst = (float *)dstBuff;
+    const __m256 scale = _mm256_set1_ps(float(scaler/SoapySDR::S8_FULL_SCALE));
+    size_t i = 0;
+    for (; i+8 <= numElems; i += 8)
+    {
+        const __m128i in = sse41UnpackCS4(_mm_loadl_epi64((const __m128i *)(src+i)));
+        _mm256_storeu_ps(dst+i*2+0, _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepi8_epi32(in)), scale));
+        _mm256_storeu_ps(dst+i*2+8, _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepi8_epi32(_mm_unpackhi_epi64(in, in))), scale));
+    }
+    for (; i < numElems; i++)
+    {
+        int8_t tmp[2];
+        SoapySDR::CS4toCS8(src[i], tmp);
+        dst[i*2+0] = SoapySDR::S8toF32(tmp[0]) * scaler;
+        dst[i*2+1] = SoapySDR::S8toF32(tmp[1]) * scaler;
+    }
+}
+
+SOAPY_SDR_AVX512_BEGIN
+static SOAPY_SDR_AVX512 void avx512CS4toCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+    auto *src = (const uint8_t *)srcBuff;
+    auto *dst = (float *)dstBuff;
+    const __m512 scale = _mm512_set1_ps(float(scaler/SoapySDR::S8_FULL_SCALE));
+    size_t i = 0;
+    for (; i+8 <= numElems; i += 8)
+    {
+        const __m128i in = sse41UnpackCS4(_mm_loadl_epi64((const __m128i *)(src+i)));
+        _mm512_storeu_ps(dst+i*2, _mm512_mul_ps(_mm512_cvtepi32_ps(_mm512_cvtepi8_epi32(in)), scale));
+    }
+    for (; i < numElems; i++)
+    {
+        int8_t tmp[2];
+        SoapySDR::CS4toCS8(src[i], tmp);
+        dst[i*2+0] = SoapySDR::S8toF32(tmp[0]) * scaler;
+        dst[i*2+1] = SoapySDR::S8toF32(tmp[1]) * scaler;
+    }
+}
+SOAPY_SDR_AVX512_END
+
+// CF32 > CS4
+static SOAPY_SDR_SSE41 void sse41CF32toCS4(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+    auto *src = (const float *)srcBuff;
+    auto *dst = (uint8_t *)dstBuff;
+    const __m128 scale = _mm_set1_ps(float(scaler));
+    const __m128 fullScale = _mm_set1_ps(SoapySDR::S8_FULL_SCALE);
+    const __m128 maxValue = _mm_set1_ps(INT8_MAX);
+    size_t i = 0;
+    for (; i+8 <= numElems; i += 8)
+    {
+        __m128i in[4];
+        for (size_t j = 0; j < 4; j++)
+        {
+            const __m128 x = _mm_mul_ps(_mm_mul_ps(_mm_loadu_ps(src+i*2+j*4), scale), fullScale);
+            in[j] = sse41CvtPS<false>(x, maxValue);
+        }
+        const __m128i out = sse41PackCS4(_mm_packs_epi16(_mm_packs_epi32(in[0], in[1]), _mm_packs_epi32(in[2], in[3])));
+        _mm_storel_epi64((__m128i *)(dst+i), _mm_packus_epi16(out, out));
+    }
+    for (; i < numElems; i++)
+    {
+        const int8_t tmp[2] = {SoapySDR::F32toS8(src[i*2+0] * scaler), SoapySDR::F32toS8(src[i*2+1] * scaler)};
+        dst[i] = SoapySDR::CS8toCS4(tmp);
+    }
+}
+
+SOAPY_SDR_AVX512_BEGIN
+static SOAPY_SDR_AVX512 void avx512CF32toCS4(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+    auto *src = (const float *)srcBuff;
+    auto *dst = (uint8_t *)dstBuff;
+    const __m512 scale = _mm512_set1_ps(float(scaler));
+    const __m512 fullScale = _mm512_set1_ps(SoapySDR::S8_FULL_SCALE);
+    const __m512 maxValue = _mm512_set1_ps(INT8_MAX);
+    size_t i = 0;
+    for (; i+8 <= numElems; i += 8)
+    {
+        const __m512 x = _mm512_mul_ps(_mm512_mul_ps(_mm512_loadu_ps(src+i*2), scale), fullScale);
+        const __m128i out = sse41PackCS4(_mm512_cvtsepi32_epi8(avx512CvtPS<false>(x, maxValue)));
+        _mm_storel_epi64((__m128i *)(dst+i), _mm_packus_epi16(out, out));
+    }
+    for (; i < numElems; i++)
+    {
+        const int8_t tmp[2] = {SoapySDR::F32toS8(src[i*2+0] * scaler), SoapySDR::F32toS8(src[i*2+1] * scaler)};
+        dst[i] = SoapySDR::CS8toCS4(tmp);
+    }
+}
+SOAPY_SDR_AVX512_END
+
+/***********************************************************************
+ * Double precision formats: F64 and CF64
+ * Only AVX2 and AVX-512 kernels are provided, 2-wide SSE offers
+ * little over the generic loops for double precision.
+ **********************************************************************/
+
+//! The full scale of a signed integer type as a double
+template <typename T>
+static inline double fullScale(void)
+{
+    return double(uint64_t(1) << (8*sizeof(T)-1));
+}
+
+//! Load 4 signed integers and widen them to int32
+static SOAPY_SDR_AVX2 inline __m128i avx2Load4(const int8_t *src)
+{
+    int32_t tmp;
+    std::memcpy(&tmp, src, sizeof(tmp));
+    return _mm_cvtepi8_epi32(_mm_cvtsi32_si128(tmp));
+}
+
+static SOAPY_SDR_AVX2 inline __m128i avx2Load4(const int16_t *src)
+{
+    return _mm_cvtepi16_epi32(_mm_loadl_epi64((const __m128i *)src));
+}
+
+static SOAPY_SDR_AVX2 inline __m128i avx2Load4(const int32_t *src)
+{
+    return _mm_loadu_si128((const __m128i *)src);
+}
+
+//! Narrow 4 int32 with saturation and store them
+static SOAPY_SDR_AVX2 inline void avx2Store4(int8_t *dst, const __m128i in)
+{
+    const __m128i out = _mm_packs_epi16(_mm_packs_epi32(in, in), in);
+    const int32_t tmp = _mm_cvtsi128_si32(out);
+    std::memcpy(dst, &tmp, sizeof(tmp));
+}
+
+static SOAPY_SDR_AVX2 inline void avx2Store4(int16_t *dst, const __m128i in)
+{
+    _mm_storel_epi64((__m128i *)dst, _mm_packs_epi32(in, in));
+}
+
+static SOAPY_SDR_AVX2 inline void avx2Store4(int32_t *dst, const __m128i in)
+{
+    _mm_storeu_si128((__m128i *)dst, in);
+}
+
+SOAPY_SDR_AVX512_BEGIN
+//! Load 8 signed integers and widen them to int32
+static SOAPY_SDR_AVX512 inline __m256i avx512Load8(const int8_t *src)
+{
+    return _mm256_cvtepi8_epi32(_mm_loadl_epi64((const __m128i *)src));
+}
+
+static SOAPY_SDR_AVX512 inline __m256i avx512Load8(const int16_t *src)
+{
+    return _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i *)src));
+}
+
+static SOAPY_SDR_AVX512 inline __m256i avx512Load8(const int32_t *src)
+{
+    return _mm256_loadu_si256((const __m256i *)src);
+}
+SOAPY_SDR_AVX512_END
+
+SOAPY_SDR_AVX512_BEGIN
+//! Narrow 16 int32 with saturation and store them
+static SOAPY_SDR_AVX512 inline void avx512Store16(int8_t *dst, const __m512i in)
+{
+    _mm_storeu_si128((__m128i *)dst, _mm512_cvtsepi32_epi8(in));
+}
+
+static SOAPY_SDR_AVX512 inline void avx512Store16(int16_t *dst, const __m512i in)
+{
+    _mm256_storeu_si256((__m256i *)dst, _mm512_cvtsepi32_epi16(in));
+}
+
+static SOAPY_SDR_AVX512 inline void avx512Store16(int32_t *dst, const __m512i in)
+{
+    _mm512_storeu_si512((__m512i *)dst, in);
+}
+SOAPY_SDR_AVX512_END
+
+// S32/S16/S8 > F64
+template <typename T, size_t elemDepth>
+static SOAPY_SDR_AVX2 void avx2IntToF64(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+    const size_t n = numElems*elemDepth;
+    auto *src = (const T *)srcBuff;
+    auto *dst = (double *)dstBuff;
+    const __m256d scale = _mm256_set1_pd(scaler/fullScale<T>());
+    size_t i = 0;
+    for (; i+8 <= n; i += 8)
+    {
+        _mm256_storeu_pd(dst+i+0, _mm256_mul_pd(_mm256_cvtepi32_pd(avx2Load4(src+i+0)), scale));
+        _mm256_storeu_pd(dst+i+4, _mm256_mul_pd(_mm256_cvtepi32_pd(avx2Load4(src+i+4)), scale));
+    }
+    for (; i < n; i++) dst[i] = (double(src[i]) / fullScale<T>()) * scaler;
+}
+
+SOAPY_SDR_AVX512_BEGIN
+template <typename T, size_t elemDepth>
+static SOAPY_SDR_AVX512 void avx512IntToF64(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+    const size_t n = numElems*elemDepth;
+    auto *src = (const T *)srcBuff;
+    auto *dst = (double *)dstBuff;
+    const __m512d scale = _mm512_set1_pd(scaler/fullScale<T>());
+    size_t i = 0;
+    for (; i+16 <= n; i += 16)
+    {
+        _mm512_storeu_pd(dst+i+0, _mm512_mul_pd(_mm512_cvtepi32_pd(avx512Load8(src+i+0)), scale));
+        _mm512_storeu_pd(dst+i+8, _mm512_mul_pd(_mm512_cvtepi32_pd(avx512Load8(src+i+8)), scale));
+    }
+    for (; i < n; i++) dst[i] = (double(src[i]) / fullScale<T>()) * scaler;
+}
+SOAPY_SDR_AVX512_END
+
+// F64 > S32/S16/S8
+template <typename T, size_t elemDepth>
+static SOAPY_SDR_AVX2 void avx2F64toInt(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+    const size_t n = numElems*elemDepth;
+    auto *src = (const double *)srcBuff;
+    auto *dst = (T *)dstBuff;
+    const __m256d scale = _mm256_set1_pd(scaler);
+    const __m256d full = _mm256_set1_pd(fullScale<T>());
+    const __m256d maxValue = _mm256_set1_pd(INT32_MAX);
+    size_t i = 0;
+    for (; i+4 <= n; i += 4)
+    {
+        //clamp the positive overflow like the float kernels, the stores saturate the rest
+        const __m256d in = _mm256_mul_pd(_mm256_mul_pd(_mm256_loadu_pd(src+i), scale), full);
+        avx2Store4(dst+i, _mm256_cvttpd_epi32(_mm256_min_pd(maxValue, in)));
+    }
+    for (; i < n; i++) dst[i] = SoapySDR::FloatToInt<T>((src[i] * scaler) * fullScale<T>());
+}
+
+SOAPY_SDR_AVX512_BEGIN
+template <typename T, size_t elemDepth>
+static SOAPY_SDR_AVX512 void avx512F64toInt(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+    const size_t n = numElems*elemDepth;
+    auto *src = (const double *)srcBuff;
+    auto *dst = (T *)dstBuff;
+    const __m512d scale = _mm512_set1_pd(scaler);
+    const __m512d full = _mm512_set1_pd(fullScale<T>());
+    const __m512d maxValue = _mm512_set1_pd(INT32_MAX);
+    size_t i = 0;
+    for (; i+16 <= n; i += 16)
+    {
+        const __m512d in0 = _mm512_min_pd(maxValue, _mm512_mul_pd(_mm512_mul_pd(_mm512_loadu_pd(src+i+0), scale), full));
+        const __m512d in1 = _mm512_min_pd(maxValue, _mm512_mul_pd(_mm512_mul_pd(_mm512_loadu_pd(src+i+8), scale), full));
+        const __m512i out = _mm512_inserti64x4(_mm512_castsi256_si512(_mm512_cvttpd_epi32(in0)), _mm512_cvttpd_epi32(in1), 1);
+        avx512Store16(dst+i, out);
+    }
+    for (; i < n; i++) dst[i] = SoapySDR::FloatToInt<T>((src[i] * scaler) * fullScale<T>());
+}
+SOAPY_SDR_AVX512_END
+
+// F32 > F64
+template <size_t elemDepth>
+static SOAPY_SDR_AVX2 void avx2F32toF64(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+    const size_t n = numElems*elemDepth;
+    auto *src = (const float *)srcBuff;
+    auto *dst = (double *)dstBuff;
+    const __m256d scale = _mm256_set1_pd(scaler);
+    size_t i = 0;
+    for (; i+8 <= n; i += 8)
+    {
+        _mm256_storeu_pd(dst+i+0, _mm256_mul_pd(_mm256_cvtps_pd(_mm_loadu_ps(src+i+0)), scale));
+        _mm256_storeu_pd(dst+i+4, _mm256_mul_pd(_mm256_cvtps_pd(_mm_loadu_ps(src+i+4)), scale));
+    }
+    for (; i < n; i++) dst[i] = double(src[i]) * scaler;
+}
+
+SOAPY_SDR_AVX512_BEGIN
+template <size_t elemDepth>
+static SOAPY_SDR_AVX512 void avx512F32toF64(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+    const size_t n = numElems*elemDepth;
+    auto *src = (const float *)srcBuff;
+    auto *dst = (double *)dstBuff;
+    const __m512d scale = _mm512_set1_pd(scaler);
+    size_t i = 0;
+    for (; i+16 <= n; i += 16)
+    {
+        _mm512_storeu_pd(dst+i+0, _mm512_mul_pd(_mm512_cvtps_pd(_mm256_loadu_ps(src+i+0)), scale));
+        _mm512_storeu_pd(dst+i+8, _mm512_mul_pd(_mm512_cvtps_pd(_mm256_loadu_ps(src+i+8)), scale));
+    }
+    for (; i < n; i++) dst[i] = double(src[i]) * scaler;
+}
+SOAPY_SDR_AVX512_END
+
+// F64 > F32
+template <size_t elemDepth>
+static SOAPY_SDR_AVX2 void avx2F64toF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+    const size_t n = numElems*elemDepth;
+    auto *src = (const double *)srcBuff;
+    auto *dst = (float *)dstBuff;
+    const __m256d scale = _mm256_set1_pd(scaler);
+    size_t i = 0;
+    for (; i+8 <= n; i += 8)
+    {
+        const __m128 out0 = _mm256_cvtpd_ps(_mm256_mul_pd(_mm256_loadu_pd(src+i+0), scale));
+        const __m128 out1 = _mm256_cvtpd_ps(_mm256_mul_pd(_mm256_loadu_pd(src+i+4), scale));
+        _mm256_storeu_ps(dst+i, _mm256_insertf128_ps(_mm256_castps128_ps256(out0), out1, 1));
+    }
+    for (; i < n; i++) dst[i] = float(src[i] * scaler);
+}
+
+SOAPY_SDR_AVX512_BEGIN
+template <size_t elemDepth>
+static SOAPY_SDR_AVX512 void avx512F64toF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+    const size_t n = numElems*elemDepth;
+    auto *src = (const double *)srcBuff;
+    auto *dst = (float *)dstBuff;
+    const __m512d scale = _mm512_set1_pd(scaler);
+    size_t i = 0;
+    for (; i+16 <= n; i += 16)
+    {
+        _mm256_storeu_ps(dst+i+0, _mm512_cvtpd_ps(_mm512_mul_pd(_mm512_loadu_pd(src+i+0), scale)));
+        _mm256_storeu_ps(dst+i+8, _mm512_cvtpd_ps(_mm512_mul_pd(_mm512_loadu_pd(src+i+8), scale)));
+    }
+    for (; i < n; i++) dst[i] = float(src[i] * scaler);
+}
+SOAPY_SDR_AVX512_END
+
+/***********************************************************************
+ * Deinterleave and interleave kernels vectorize the two channel case,
+ * which splits complex samples into planar I and Q buffers and back.
+ * Other channel counts use the scalar loop for the whole buffer.
+ **********************************************************************/
+
+// S16 > F32 deinterleave
+static SOAPY_SDR_SSE41 void sse41DeinterleaveS16toF32(const void *srcBuff, void * const *dstBuffs, const size_t numChans, const size_t numElems, const double scaler)
+{
+    auto *src = (const int16_t *)srcBuff;
+    const __m128 scale = _mm_set1_ps(float(scaler/SoapySDR::S16_FULL_SCALE));
+    size_t i = 0;
+    if (numChans == 2) for (; i+4 <= numElems; i += 4)
+    {
+        const __m128i in = _mm_loadu_si128((const __m128i *)(src+i*2));
+        const __m128i ch0 = _mm_srai_epi32(_mm_slli_epi32(in, 16), 16);
+        const __m128i ch1 = _mm_srai_epi32(in, 16);
+        _mm_storeu_ps((float *)dstBuffs[0]+i, _mm_mul_ps(_mm_cvtepi32_ps(ch0), scale));
+        _mm_storeu_ps((float *)dstBuffs[1]+i, _mm_mul_ps(_mm_cvtepi32_ps(ch1), scale));
+    }
+    for (; i < numElems; i++)
+    {
+        for (size_t ch = 0; ch < numChans; ch++) ((float *)dstBuffs[ch])[i] = SoapySDR::S16toF32(src[i*numChans+ch]) * scaler;
+    }
+}
+
+static SOAPY_SDR_AVX2 void avx2DeinterleaveS16toF32(const void *srcBuff, void * const *dstBuffs, const size_t numChans, const size_t numElems, const double scaler)
+{
+    auto *src = (const int16_t *)srcBuff;
+    const __m256 scale = _mm256_set1_ps(float(scaler/SoapySDR::S16_FULL_SCALE));
+    size_t i = 0;
+    if (numChans == 2) for (; i+8 <= numElems; i += 8)
+    {
+        const __m256i in = _mm256_loadu_si256((const __m256i *)(src+i*2));
+        const __m256i ch0 = _mm256_srai_epi32(_mm256_slli_epi32(in, 16), 16);
+        const __m256i ch1 = _mm256_srai_epi32(in, 16);
+        _mm256_storeu_ps((float *)dstBuffs[0]+i, _mm256_mul_ps(_mm256_cvtepi32_ps(ch0), scale));
+        _mm256_storeu_ps((float *)dstBuffs[1]+i, _mm256_mul_ps(_mm256_cvtepi32_ps(ch1), scale));
+    }
+    for (; i < numElems; i++)
+    {
+        for (size_t ch = 0; ch < numChans; ch++) ((float *)dstBuffs[ch])[i] = SoapySDR::S16toF32(src[i*numChans+ch]) * scaler;
+    }
+}
+
+// F32 > S16 interleave
+static SOAPY_SDR_SSE41 void sse41InterleaveF32toS16(const void * const *srcBuffs, void *dstBuff, const size_t numChans, const size_t numElems, const double scaler)
+{
+    auto *dst = (int16_t *)dstBuff;
+    const __m128 scale = _mm_set1_ps(float(scaler*SoapySDR::S16_FULL_SCALE));
+    const __m128 maxValue = _mm_set1_ps(INT16_MAX);
+    size_t i = 0;
+    if (numChans == 2) for (; i+4 <= numElems; i += 4)
+    {
+        const __m128i ch0 = sse41CvtPS<false>(_mm_mul_ps(_mm_loadu_ps((const float *)srcBuffs[0]+i), scale), maxValue);
+        const __m128i ch1 = sse41CvtPS<false>(_mm_mul_ps(_mm_loadu_ps((const float *)srcBuffs[1]+i), scale), maxValue);
+        const __m128i out = _mm_unpacklo_epi16(_mm_packs_epi32(ch0, ch0), _mm_packs_epi32(ch1, ch1));
+        _mm_storeu_si128((__m128i *)(dst+i*2), out);
+    }
+    for (; i < numElems; i++)
+    {
+        for (size_t ch = 0; ch < numChans; ch++) dst[i*numChans+ch] = SoapySDR::F32toS16(((const float *)srcBuffs[ch])[i] * scaler);
+    }
+}
+
+static SOAPY_SDR_AVX2 void avx2InterleaveF32toS16(const void * const *srcBuffs, void *dstBuff, const size_t numChans, const size_t numElems, const double scaler)
+{
+    auto *dst = (int16_t *)dstBuff;
+    const __m256 scale = _mm256_set1_ps(float(scaler*SoapySDR::S16_FULL_SCALE));
+    const __m256 maxValue = _mm256_set1_ps(INT16_MAX);
+    size_t i = 0;
+    if (numChans == 2) for (; i+8 <= numElems; i += 8)
+    {
+        const __m256i ch0 = avx2CvtPS<false>(_mm256_mul_ps(_mm256_loadu_ps((const float *)srcBuffs[0]+i), scale), maxValue);
+        const __m256i ch1 = avx2CvtPS<false>(_mm256_mul_ps(_mm256_loadu_ps((const float *)srcBuffs[1]+i), scale), maxValue);
+        //packs and unpack operate per 128-bit lane, which keeps the samples in order
+        const __m256i out = _mm256_unpacklo_epi16(_mm256_packs_epi32(ch0, ch0), _mm256_packs_epi32(ch1, ch1));
+        _mm256_storeu_si256((__m256i *)(dst+i*2), out);
+    }
+    for (; i < numElems; i++)
+    {
+        for (size_t ch = 0; ch < numChans; ch++) dst[i*numChans+ch] = SoapySDR::F32toS16(((const float *)srcBuffs[ch])[i] * scaler);
+    }
+}
+
+// F32 > F32 deinterleave
+static SOAPY_SDR_SSE41 void sse41DeinterleaveF32toF32(const void *srcBuff, void * const *dstBuffs, const size_t numChans, const size_t numElems, const double scaler)
+{
+    auto *src = (const float *)srcBuff;
+    const __m128 scale = _mm_set1_ps(float(scaler));
+    size_t i = 0;
+    if (numChans == 2) for (; i+4 <= numElems; i += 4)
+    {
+        const __m128 in0 = _mm_loadu_ps(src+i*2+0);
+        const __m128 in1 = _mm_loadu_ps(src+i*2+4);
+        _mm_storeu_ps((float *)dstBuffs[0]+i, _mm_mul_ps(_mm_shuffle_ps(in0, in1, _MM_SHUFFLE(2, 0, 2, 0)), scale));
+        _mm_storeu_ps((float *)dstBuffs[1]+i, _mm_mul_ps(_mm_shuffle_ps(in0, in1, _MM_SHUFFLE(3, 1, 3, 1)), scale));
+    }
+    for (; i < numElems; i++)
+    {
+        for (size_t ch = 0; ch < numChans; ch++) ((float *)dstBuffs[ch])[i] = src[i*numChans+ch] * scaler;
+    }
+}
+
+static SOAPY_SDR_AVX2 void avx2DeinterleaveF32toF32(const void *srcBuff, void * const *dstBuffs, const size_t numChans, const size_t numElems, const double scaler)
+{
+    auto *src = (const float *)srcBuff;
+    const __m256 scale = _mm256_set1_ps(float(scaler));
+    size_t i = 0;
+    if (numChans == 2) for (; i+8 <= numElems; i += 8)
+    {
+        const __m256 in0 = _mm256_loadu_ps(src+i*2+0);
+        const __m256 in1 = _mm256_loadu_ps(src+i*2+8);
+        //shuffle operates per 128-bit lane, restore the sample order with a permute
+        const __m256 ch0 = _mm256_shuffle_ps(in0, in1, _MM_SHUFFLE(2, 0, 2, 0));
+        const __m256 ch1 = _mm256_shuffle_ps(in0, in1, _MM_SHUFFLE(3, 1, 3, 1));
+        _mm256_storeu_ps((float *)dstBuffs[0]+i, _mm256_mul_ps(_mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(ch0), 0xd8)), scale));
+        _mm256_storeu_ps((float *)dstBuffs[1]+i, _mm256_mul_ps(_mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(ch1), 0xd8)), scale));
+    }
+    for (; i < numElems; i++)
+    {
+        for (size_t ch = 0; ch < numChans; ch++) ((float *)dstBuffs[ch])[i] = src[i*numChans+ch] * scaler;
+    }
+}
+
+// F32 > F32 interleave
+static SOAPY_SDR_SSE41 void sse41InterleaveF32toF32(const void * const *srcBuffs, void *dstBuff, const size_t numChans, const size_t numElems, const double scaler)
+{
+    auto *dst = (float *)dstBuff;
+    const __m128 scale = _mm_set1_ps(float(scaler));
+    size_t i = 0;
+    if (numChans == 2) for (; i+4 <= numElems; i += 4)
+    {
+        const __m128 ch0 = _mm_mul_ps(_mm_loadu_ps((const float *)srcBuffs[0]+i), scale);
+        const __m128 ch1 = _mm_mul_ps(_mm_loadu_ps((const float *)srcBuffs[1]+i), scale);
+        _mm_storeu_ps(dst+i*2+0, _mm_unpacklo_ps(ch0, ch1));
+        _mm_storeu_ps(dst+i*2+4, _mm_unpackhi_ps(ch0, ch1));
+    }
+    for (; i < numElems; i++)
+    {
+        for (size_t ch = 0; ch < numChans; ch++) dst[i*numChans+ch] = ((const float *)srcBuffs[ch])[i] * scaler;
+    }
+}
+
+static SOAPY_SDR_AVX2 void avx2InterleaveF32toF32(const void * const *srcBuffs, void *dstBuff, const size_t numChans, const size_t numElems, const double scaler)
+{
+    auto *dst = (float *)dstBuff;
+    const __m256 scale = _mm256_set1_ps(float(scaler));
+    size_t i = 0;
+    if (numChans == 2) for (; i+8 <= numElems; i += 8)
+    {
+        const __m256 ch0 = _mm256_mul_ps(_mm256_loadu_ps((const float *)srcBuffs[0]+i), scale);
+        const __m256 ch1 = _mm256_mul_ps(_mm256_loadu_ps((const float *)srcBuffs[1]+i), scale);
+        //unpack operates per 128-bit lane, gather the halves in order with a permute
+        const __m256 lo = _mm256_unpacklo_ps(ch0, ch1);
+        const __m256 hi = _mm256_unpackhi_ps(ch0, ch1);
+        _mm256_storeu_ps(dst+i*2+0, _mm256_permute2f128_ps(lo, hi, 0x20));
+        _mm256_storeu_ps(dst+i*2+8, _mm256_permute2f128_ps(lo, hi, 0x31));
+    }
+    for (; i < numElems; i++)
+    {
+        for (size_t ch = 0; ch < numChans; ch++) dst[i*numChans+ch] = ((const float *)srcBuffs[ch])[i] * scaler;
+    }
+}
+
+/***********************************************************************
+ * Complex multi-channel kernels convert four elements of one channel
+ * per vector, and move each element between the planar and the
+ * channel-interleaved layout with a 32 or 64-bit load or store.
+ **********************************************************************/
+
+// CS16 > CF32 interleave
+static SOAPY_SDR_AVX2 void avx2InterleaveCS16toCF32(const void * const *srcBuffs, void *dstBuff, const size_t numChans, const size_t numElems, const double scaler)
+{
+    auto *dst = (float *)dstBuff;
+    const size_t stride = numChans*2;
+    const __m256 scale = _mm256_set1_ps(float(scaler/SoapySDR::S16_FULL_SCALE));
+    size_t i = 0;
+    for (; i+4 <= numElems; i += 4)
+    {
+        for (size_t ch = 0; ch < numChans; ch++)
+        {
+            const __m128i in = _mm_loadu_si128((const __m128i *)((const int16_t *)srcBuffs[ch]+i*2));
+            const __m256 out = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(in)), scale);
+            const __m128 lo = _mm256_castps256_ps128(out);
+            const __m128 hi = _mm256_extractf128_ps(out, 1);
+            float *d = dst + (i*numChans+ch)*2;
+            _mm_storel_pi((__m64 *)(d+0*stride), lo);
+            _mm_storeh_pi((__m64 *)(d+1*stride), lo);
+            _mm_storel_pi((__m64 *)(d+2*stride), hi);
+            _mm_storeh_pi((__m64 *)(d+3*stride), hi);
+        }
+    }
+    for (; i < numElems; i++)
+    {
+        for (size_t ch = 0; ch < numChans; ch++)
+        {
+            const auto *src = (const int16_t *)srcBuffs[ch]+i*2;
+            dst[(i*numChans+ch)*2+0] = SoapySDR::S16toF32(src[0]) * scaler;
+            dst[(i*numChans+ch)*2+1] = SoapySDR::S16toF32(src[1]) * scaler;
+        }
+    }
+}
+
+// CS16 > CF32 deinterleave
+static SOAPY_SDR_AVX2 void avx2DeinterleaveCS16toCF32(const void *srcBuff, void * const *dstBuffs, const size_t numChans, const size_t numElems, const double scaler)
+{
+    auto *src = (const int16_t *)srcBuff;
+    const size_t stride = numChans*2;
+    const __m256 scale = _mm256_set1_ps(float(scaler/SoapySDR::S16_FULL_SCALE));
+    size_t i = 0;
+    for (; i+4 <= numElems; i += 4)
+    {
+        for (size_t ch = 0; ch < numChans; ch++)
+        {
+            const int16_t *s = src + (i*numChans+ch)*2;
+            int32_t elems[4];
+            for (size_t k = 0; k < 4; k++) std::memcpy(elems+k, s+k*stride, sizeof(int32_t));
+            const __m128i in = _mm_loadu_si128((const __m128i *)elems);
+            const __m256 out = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(in)), scale);
+            _mm256_storeu_ps((float *)dstBuffs[ch]+i*2, out);
+        }
+    }
+    for (; i < numElems; i++)
+    {
+        for (size_t ch = 0; ch < numChans; ch++)
+        {
+            auto *dst = (float *)dstBuffs[ch]+i*2;
+            dst[0] = SoapySDR::S16toF32(src[(i*numChans+ch)*2+0]) * scaler;
+            dst[1] = SoapySDR::S16toF32(src[(i*numChans+ch)*2+1]) * scaler;
+        }
+    }
+}
+
+// CF32 > CS16 interleave
+static SOAPY_SDR_AVX2 void avx2InterleaveCF32toCS16(const void * const *srcBuffs, void *dstBuff, const size_t numChans, const size_t numElems, const double scaler)
+{
+    auto *dst = (int16_t *)dstBuff;
+    const size_t stride = numChans*2;
+    const __m256 scale = _mm256_set1_ps(float(scaler*SoapySDR::S16_FULL_SCALE));
+    const __m256 maxValue = _mm256_set1_ps(INT16_MAX);
+    size_t i = 0;
+    for (; i+4 <= numElems; i += 4)
+    {
+        for (size_t ch = 0; ch < numChans; ch++)
+        {
+            const __m256i in = avx2CvtPS<false>(_mm256_mul_ps(_mm256_loadu_ps((const float *)srcBuffs[ch]+i*2), scale), maxValue);
+            int32_t elems[4];
+            _mm_storeu_si128((__m128i *)elems, _mm_packs_epi32(_mm256_castsi256_si128(in), _mm256_extracti128_si256(in, 1)));
+            int16_t *d = dst + (i*numChans+ch)*2;
+            for (size_t k = 0; k < 4; k++) std::memcpy(d+k*stride, elems+k, sizeof(int32_t));
+        }
+    }
+    for (; i < numElems; i++)
+    {
+        for (size_t ch = 0; ch < numChans; ch++)
+        {
+            const auto *src = (const float *)srcBuffs[ch]+i*2;
+            dst[(i*numChans+ch)*2+0] = SoapySDR::F32toS16(src[0] * scaler);
+            dst[(i*numChans+ch)*2+1] = SoapySDR::F32toS16(src[1] * scaler);
+        }
+    }
+}
+
+// CF32 > CS16 deinterleave
+static SOAPY_SDR_AVX2 void avx2DeinterleaveCF32toCS16(const void *srcBuff, void * const *dstBuffs, const size_t numChans, const size_t numElems, const double scaler)
+{
+    auto *src = (const float *)srcBuff;
+    const size_t stride = numChans*2;
+    const __m256 scale = _mm256_set1_ps(float(scaler*SoapySDR::S16_FULL_SCALE));
+    const __m256 maxValue = _mm256_set1_ps(INT16_MAX);
+    size_t i = 0;
+    for (; i+4 <= numElems; i += 4)
+    {
+        for (size_t ch = 0; ch < numChans; ch++)
+        {
+            const float *s = src + (i*numChans+ch)*2;
+            const __m128 lo = _mm_loadh_pi(_mm_castpd_ps(_mm_load_sd((const double *)(s+0*stride))), (const __m64 *)(s+1*stride));
+            const __m128 hi = _mm_loadh_pi(_mm_castpd_ps(_mm_load_sd((const double *)(s+2*stride))), (const __m64 *)(s+3*stride));
+            const __m256i in = avx2CvtPS<false>(_mm256_mul_ps(_mm256_set_m128(hi, lo), scale), maxValue);
+            const __m128i out = _mm_packs_epi32(_mm256_castsi256_si128(in), _mm256_extracti128_si256(in, 1));
+            _mm_storeu_si128((__m128i *)((int16_t *)dstBuffs[ch]+i*2), out);
+        }
+    }
+    for (; i < numElems; i++)
+    {
+        for (size_t ch = 0; ch < numChans; ch++)
+        {
+            auto *dst = (int16_t *)dstBuffs[ch]+i*2;
+            dst[0] = SoapySDR::F32toS16(src[(i*numChans+ch)*2+0] * scaler);
+            dst[1] = SoapySDR::F32toS16(src[(i*numChans+ch)*2+1] * scaler);
+        }
+    }
+}
+
+/***********************************************************************
+ * Correction kernels fold the scaler, the full scale, the DC offset,
+ * and the IQ matrix into one affine transform of the raw integers.
+ * The diagonal terms multiply the samples in place, and the cross
+ * terms multiply the samples with I and Q swapped.
+ **********************************************************************/
+
+struct CorrectionCoeffs
+{
+    float a00, a01, a10, a11, bI, bQ;
+};
+
+template <typename SrcType>
+static CorrectionCoeffs foldCorrection(const double scaler, const SoapySDR::ConverterRegistry::Correction &correction)
+{
+    //out = matrix * (scaler * x / fullScale - dcOffset)
+    const auto &m = correction.matrix;
+    const double scale = scaler/fullScale<SrcType>();
+    CorrectionCoeffs c;
+    c.a00 = float(m[0][0]*scale);
+    c.a01 = float(m[0][1]*scale);
+    c.a10 = float(m[1][0]*scale);
+    c.a11 = float(m[1][1]*scale);
+    c.bI = float(-(m[0][0]*correction.dcOffset.real() + m[0][1]*correction.dcOffset.imag()));
+    c.bQ = float(-(m[1][0]*correction.dcOffset.real() + m[1][1]*correction.dcOffset.imag()));
+    return c;
+}
+
+//! The raw integer value of a sample, unsigned values have the zero offset removed
+static inline int rawValue(const int16_t in) {return in;}
+static inline int rawValue(const int8_t in) {return in;}
+static inline int rawValue(const uint8_t in) {return SoapySDR::U8toS8(in);}
+
+//! Load 4 integers and widen them to int32, unsigned values have the zero offset removed
+static SOAPY_SDR_SSE41 inline __m128i sse41Widen4(const int16_t *src)
+{
+    return _mm_cvtepi16_epi32(_mm_loadl_epi64((const __m128i *)src));
+}
+
+static SOAPY_SDR_SSE41 inline __m128i sse41Widen4(const int8_t *src)
+{
+    int32_t tmp;
+    std::memcpy(&tmp, src, sizeof(tmp));
+    return _mm_cvtepi8_epi32(_mm_cvtsi32_si128(tmp));
+}
+
+static SOAPY_SDR_SSE41 inline __m128i sse41Widen4(const uint8_t *src)
+{
+    int32_t tmp;
+    std::memcpy(&tmp, src, sizeof(tmp));
+    return _mm_sub_epi32(_mm_cvtepu8_epi32(_mm_cvtsi32_si128(tmp)), _mm_set1_epi32(SoapySDR::U8_ZERO_OFFSET));
+}
+
+//! Load 8 integers and widen them to int32, unsigned values have the zero offset removed
+static SOAPY_SDR_AVX2 inline __m256i avx2Widen8(const int16_t *src)
+{
+    return _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i *)src));
+}
+
+static SOAPY_SDR_AVX2 inline __m256i avx2Widen8(const int8_t *src)
+{
+    return _mm256_cvtepi8_epi32(_mm_loadl_epi64((const __m128i *)src));
+}
+
+static SOAPY_SDR_AVX2 inline __m256i avx2Widen8(const uint8_t *src)
+{
+    return _mm256_sub_epi32(_mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i *)src)), _mm256_set1_epi32(SoapySDR::U8_ZERO_OFFSET));
+}
+
+// CS16/CS8/CU8 > CF32 with correction
+template <typename SrcType>
+static SOAPY_SDR_SSE41 void sse41CorrectToCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler, const SoapySDR::ConverterRegistry::Correction &correction)
+{
+    auto *src = (const SrcType *)srcBuff;
+    auto *dst = (float *)dstBuff;
+    const auto c = foldCorrection<SrcType>(scaler, correction);
+    const __m128 diag = _mm_setr_ps(c.a00, c.a11, c.a00, c.a11);
+    const __m128 cross = _mm_setr_ps(c.a01, c.a10, c.a01, c.a10);
+    const __m128 bias = _mm_setr_ps(c.bI, c.bQ, c.bI, c.bQ);
+    size_t i = 0;
+    for (; i+2 <= numElems; i += 2)
+    {
+        const __m128 x = _mm_cvtepi32_ps(sse41Widen4(src+i*2));
+        const __m128 swapped = _mm_shuffle_ps(x, x, _MM_SHUFFLE(2, 3, 0, 1));
+        _mm_storeu_ps(dst+i*2, _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, diag), _mm_mul_ps(swapped, cross)), bias));
+    }
+    for (; i < numElems; i++)
+    {
+        const float xI = float(rawValue(src[i*2+0]));
+        const float xQ = float(rawValue(src[i*2+1]));
+        dst[i*2+0] = c.a00*xI + c.a01*xQ + c.bI;
+        dst[i*2+1] = c.a10*xI + c.a11*xQ + c.bQ;
+    }
+}
+
+template <typename SrcType>
+static SOAPY_SDR_AVX2 void avx2CorrectToCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler, const SoapySDR::ConverterRegistry::Correction &correction)
+{
+    auto *src = (const SrcType *)srcBuff;
+    auto *dst = (float *)dstBuff;
+    const auto c = foldCorrection<SrcType>(scaler, correction);
+    const __m256 diag = _mm256_setr_ps(c.a00, c.a11, c.a00, c.a11, c.a00, c.a11, c.a00, c.a11);
+    const __m256 cross = _mm256_setr_ps(c.a01, c.a10, c.a01, c.a10, c.a01, c.a10, c.a01, c.a10);
+    const __m256 bias = _mm256_setr_ps(c.bI, c.bQ, c.bI, c.bQ, c.bI, c.bQ, c.bI, c.bQ);
+    size_t i = 0;
+    for (; i+4 <= numElems; i += 4)
+    {
+        const __m256 x = _mm256_cvtepi32_ps(avx2Widen8(src+i*2));
+        const __m256 swapped = _mm256_permute_ps(x, _MM_SHUFFLE(2, 3, 0, 1));
+        _mm256_storeu_ps(dst+i*2, _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(x, diag), _mm256_mul_ps(swapped, cross)), bias));
+    }
+    for (; i < numElems; i++)
+    {
+        const float xI = float(rawValue(src[i*2+0]));
+        const float xQ = float(rawValue(src[i*2+1]));
+        dst[i*2+0] = c.a00*xI + c.a01*xQ + c.bI;
+        dst[i*2+1] = c.a10*xI + c.a11*xQ + c.bQ;
+    }
+}
+
+/***********************************************************************
+ * Statistics kernels accumulate the peak and the power of the
+ * converted samples in registers, and count the clipped samples
+ * by comparing the widened integers against the format limits.
+ * The power of each sample is summed in double precision.
+ **********************************************************************/
+
+//! Running statistics of the samples in the remainder loops and the final reduction
+struct StatisticsSums
+{
+    StatisticsSums(void): peakPower(0.0), sumPower(0.0), clipCount(0) {}
+    double peakPower;
+    double sumPower;
+    size_t clipCount;
+};
+
+template <typename SrcType>
+static void statisticsRemainder(const SrcType *src, float *dst, size_t i, const size_t numElems, const float scale, StatisticsSums &sums)
+{
+    const int minValue = rawValue(std::numeric_limits<SrcType>::min());
+    const int maxValue = rawValue(std::numeric_limits<SrcType>::max());
+    for (; i < numElems; i++)
+    {
+        const int xI = rawValue(src[i*2+0]);
+        const int xQ = rawValue(src[i*2+1]);
+        const float yI = xI*scale;
+        const float yQ = xQ*scale;
+        dst[i*2+0] = yI;
+        dst[i*2+1] = yQ;
+        const double power = double(yI)*yI + double(yQ)*yQ;
+        sums.peakPower = std::max(sums.peakPower, power);
+        sums.sumPower += power;
+        if (xI == minValue or xI == maxValue or xQ == minValue or xQ == maxValue) sums.clipCount++;
+    }
+}
+
+static void finishStatistics(const StatisticsSums &sums, const size_t numElems, SoapySDR::ConverterRegistry::Statistics &stats)
+{
+    stats.peak = std::sqrt(sums.peakPower);
+    stats.meanPower = (numElems == 0)?0.0:sums.sumPower/numElems;
+    stats.clipCount = sums.clipCount;
+}
+
+//! Count the samples with a clipped I or Q, given one mask bit per I and Q lane
+static inline size_t countClipped(const int mask)
+{
+    return size_t(__builtin_popcount((mask | (mask >> 1)) & 0x55));
+}
+
+// CS16/CS8/CU8 > CF32 with statistics
+template <typename SrcType>
+static SOAPY_SDR_SSE41 void sse41StatisticsToCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler, SoapySDR::ConverterRegistry::Statistics &stats)
+{
+    auto *src = (const SrcType *)srcBuff;
+    auto *dst = (float *)dstBuff;
+    const float scale = float(scaler/fullScale<SrcType>());
+    const __m128 scaleV = _mm_set1_ps(scale);
+    const __m128i minV = _mm_set1_epi32(rawValue(std::numeric_limits<SrcType>::min()));
+    const __m128i maxV = _mm_set1_epi32(rawValue(std::numeric_limits<SrcType>::max()));
+    __m128 peak = _mm_setzero_ps();
+    __m128d sum = _mm_setzero_pd();
+    StatisticsSums sums;
+    size_t i = 0;
+    for (; i+2 <= numElems; i += 2)
+    {
+        const __m128i x = sse41Widen4(src+i*2);
+        const __m128 y = _mm_mul_ps(_mm_cvtepi32_ps(x), scaleV);
+        _mm_storeu_ps(dst+i*2, y);
+
+        //the I and Q lanes of a sample both hold its power after adding the swapped squares
+        const __m128 sq = _mm_mul_ps(y, y);
+        peak = _mm_max_ps(peak, _mm_add_ps(sq, _mm_shuffle_ps(sq, sq, _MM_SHUFFLE(2, 3, 0, 1))));
+        sum = _mm_add_pd(sum, _mm_add_pd(_mm_cvtps_pd(sq), _mm_cvtps_pd(_mm_movehl_ps(sq, sq))));
+
+        const __m128i clipped = _mm_or_si128(_mm_cmpeq_epi32(x, minV), _mm_cmpeq_epi32(x, maxV));
+        sums.clipCount += countClipped(_mm_movemask_ps(_mm_castsi128_ps(clipped)));
+    }
+
+    float peakLanes[4];
+    double sumLanes[2];
+    _mm_storeu_ps(peakLanes, peak);
+    _mm_storeu_pd(sumLanes, sum);
+    for (const float p : peakLanes) sums.peakPower = std::max(sums.peakPower, double(p));
+    sums.sumPower = sumLanes[0] + sumLanes[1];
+    statisticsRemainder(src, dst, i, numElems, scale, sums);
+    finishStatistics(sums, numElems, stats);
+}
+
+template <typename SrcType>
+static SOAPY_SDR_AVX2 void avx2StatisticsToCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler, SoapySDR::ConverterRegistry::Statistics &stats)
+{
+    auto *src = (const SrcType *)srcBuff;
+    auto *dst = (float *)dstBuff;
+    const float scale = float(scaler/fullScale<SrcType>());
+    const __m256 scaleV = _mm256_set1_ps(scale);
+    const __m256i minV = _mm256_set1_epi32(rawValue(std::numeric_limits<SrcType>::min()));
+    const __m256i maxV = _mm256_set1_epi32(rawValue(std::numeric_limits<SrcType>::max()));
+    __m256 peak = _mm256_setzero_ps();
+    __m256d sum = _mm256_setzero_pd();
+    StatisticsSums sums;
+    size_t i = 0;
+    for (; i+4 <= numElems; i += 4)
+    {
+        const __m256i x = avx2Widen8(src+i*2);
+        const __m256 y = _mm256_mul_ps(_mm256_cvtepi32_ps(x), scaleV);
+        _mm256_storeu_ps(dst+i*2, y);
+
+        //the I and Q lanes of a sample both hold its power after adding the swapped squares
+        const __m256 sq = _mm256_mul_ps(y, y);
+        peak = _mm256_max_ps(peak, _mm256_add_ps(sq, _mm256_permute_ps(sq, _MM_SHUFFLE(2, 3, 0, 1))));
+        sum = _mm256_add_pd(sum, _mm256_add_pd(
+            _mm256_cvtps_pd(_mm256_castps256_ps128(sq)), _mm256_cvtps_pd(_mm256_extractf128_ps(sq, 1))));
+
+        const __m256i clipped = _mm256_or_si256(_mm256_cmpeq_epi32(x, minV), _mm256_cmpeq_epi32(x, maxV));
+        sums.clipCount += countClipped(_mm256_movemask_ps(_mm256_castsi256_ps(clipped)));
+    }
+
+    float peakLanes[8];
+    double sumLanes[4];
+    _mm256_storeu_ps(peakLanes, peak);
+    _mm256_storeu_pd(sumLanes, sum);
+    for (const float p : peakLanes) sums.peakPower = std::max(sums.peakPower, double(p));
+    sums.sumPower = sumLanes[0] + sumLanes[1] + sumLanes[2] + sumLanes[3];
+    statisticsRemainder(src, dst, i, numElems, scale, sums);
+    finishStatistics(sums, numElems, stats);
+}
+
+/***********************************************************************
+ * Big endian kernels: a byte shuffle swaps to or from host order
+ * in the same pass as the conversion, so the wire format costs
+ * no extra pass over the buffer. The shuffle masks are the same
+ * in both 128-bit lanes, so the AVX2 shuffle needs no permute.
+ **********************************************************************/
+
+//! The byte shuffle mask which reverses each 16 or 32-bit value
+template <typename T>
+static SOAPY_SDR_SSE41 inline __m128i sse41SwapMask(void)
+{
+    return (sizeof(T) == 2)?
+        _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14):
+        _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+}
+
+template <typename T>
+static SOAPY_SDR_AVX2 inline __m256i avx2SwapMask(void)
+{
+    const __m128i mask = sse41SwapMask<T>();
+    return _mm256_inserti128_si256(_mm256_castsi128_si256(mask), mask, 1);
+}
+
+//! Scalar swap and scale, the scaler is applied in host order
+template <typename T, T (*swap)(T), bool toBigEndian>
+static inline T swapValue(const T in, const double scaler)
+{
+    if (scaler == 1.0) return swap(in);
+    return toBigEndian?swap(T(in * scaler)):T(swap(in) * scaler);
+}
+
+// S16/S32 <> S16BE/S32BE (only the unit scaler is vectorized)
+template <typename T, T (*swap)(T), size_t elemDepth, bool toBigEndian>
+static SOAPY_SDR_SSE41 void sse41Swap(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+    const size_t n = numElems*elemDepth;
+    auto *src = (const T *)srcBuff;
+    auto *dst = (T *)dstBuff;
+    const __m128i mask = sse41SwapMask<T>();
+    const size_t step = sizeof(__m128i)/sizeof(T);
+    size_t i = 0;
+    if (scaler == 1.0) for (; i+step <= n; i += step)
+    {
+        const __m128i in = _mm_loadu_si128((const __m128i *)(src+i));
+        _mm_storeu_si128((__m128i *)(dst+i), _mm_shuffle_epi8(in, mask));
+    }
+    for (; i < n; i++) dst[i] = swapValue<T, swap, toBigEndian>(src[i], scaler);
+}
+
+template <typename T, T (*swap)(T), size_t elemDepth, bool toBigEndian>
+static SOAPY_SDR_AVX2 void avx2Swap(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+    const size_t n = numElems*elemDepth;
+    auto *src = (const T *)srcBuff;
+    auto *dst = (T *)dstBuff;
+    const __m256i mask = avx2SwapMask<T>();
+    const size_t step = sizeof(__m256i)/sizeof(T);
+    size_t i = 0;
+    if (scaler == 1.0) for (; i+step <= n; i += step)
+    {
+        const __m256i in = _mm256_loadu_si256((const __m256i *)(src+i));
+        _mm256_storeu_si256((__m256i *)(dst+i), _mm256_shuffle_epi8(in, mask));
+    }
+    for (; i < n; i++) dst[i] = swapValue<T, swap, toBigEndian>(src[i], scaler);
+}
+
+// S16BE > F32
+template <size_t elemDepth>
+static SOAPY_SDR_SSE41 void sse41S16BEtoF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+    const size_t n = numElems*elemDepth;
+    auto *src = (const int16_t *)srcBuff;
+    auto *dst = (float *)dstBuff;
+    const __m128i mask = sse41SwapMask<int16_t>();
+    const __m128 scale = _mm_set1_ps(float(scaler/SoapySDR::S16_FULL_SCALE));
+    size_t i = 0;
+    for (; i+8 <= n; i += 8)
+    {
+        const __m128i in = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(src+i)), mask);
+        const __m128i lo = _mm_cvtepi16_epi32(in);
+        const __m128i hi = _mm_cvtepi16_epi32(_mm_unpackhi_epi64(in, in));
+        _mm_storeu_ps(dst+i+0, _mm_mul_ps(_mm_cvtepi32_ps(lo), scale));
+        _mm_storeu_ps(dst+i+4, _mm_mul_ps(_mm_cvtepi32_ps(hi), scale));
+    }
+    for (; i < n; i++) dst[i] = SoapySDR::S16toF32(SoapySDR::S16BEtoS16(src[i])) * scaler;
+}
+
+template <size_t elemDepth>
+static SOAPY_SDR_AVX2 void avx2S16BEtoF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+    const size_t n = numElems*elemDepth;
+    auto *src = (const int16_t *)srcBuff;
+    auto *dst = (float *)dstBuff;
+    const __m256i mask = avx2SwapMask<int16_t>();
+    const __m256 scale = _mm256_set1_ps(float(scaler/SoapySDR::S16_FULL_SCALE));
+    size_t i = 0;
+    for (; i+16 <= n; i += 16)
+    {
+        const __m256i in = _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i *)(src+i)), mask);
+        const __m256i lo = _mm256_cvtepi16_epi32(_mm256_castsi256_si128(in));
+        const __m256i hi = _mm256_cvtepi16_epi32(_mm256_extracti128_si256(in, 1));
+        _mm256_storeu_ps(dst+i+0, _mm256_mul_ps(_mm256_cvtepi32_ps(lo), scale));
+        _mm256_storeu_ps(dst+i+8, _mm256_mul_ps(_mm256_cvtepi32_ps(hi), scale));
+    }
+    for (; i < n; i++) dst[i] = SoapySDR::S16toF32(SoapySDR::S16BEtoS16(src[i])) * scaler;
+}
+
+// F32 > S16BE
+template <size_t elemDepth>
+static SOAPY_SDR_SSE41 void sse41F32toS16BE(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+    const size_t n = numElems*elemDepth;
+    auto *src = (const float *)srcBuff;
+    auto *dst = (int16_t *)dstBuff;
+    const __m128i mask = sse41SwapMask<int16_t>();
+    const __m128 scale = _mm_set1_ps(float(scaler));
+    const __m128 fullScale = _mm_set1_ps(SoapySDR::S16_FULL_SCALE);
+    const __m128 maxValue = _mm_set1_ps(INT16_MAX);
+    size_t i = 0;
+    for (; i+8 <= n; i += 8)
+    {
+        const __m128 in0 = _mm_mul_ps(_mm_mul_ps(_mm_loadu_ps(src+i+0), scale), fullScale);
+        const __m128 in1 = _mm_mul_ps(_mm_mul_ps(_mm_loadu_ps(src+i+4), scale), fullScale);
+        const __m128i out = _mm_packs_epi32(sse41CvtPS<false>(in0, maxValue), sse41CvtPS<false>(in1, maxValue));
+        _mm_storeu_si128((__m128i *)(dst+i), _mm_shuffle_epi8(out, mask));
+    }
+    for (; i < n; i++) dst[i] = SoapySDR::S16toS16BE(SoapySDR::F32toS16(src[i] * scaler));
+}
+
+template <size_t elemDepth>
+static SOAPY_SDR_AVX2 void avx2F32toS16BE(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+    const size_t n = numElems*elemDepth;
+    auto *src = (const float *)srcBuff;
+    auto *dst = (int16_t *)dstBuff;
+    const __m256i mask = avx2SwapMask<int16_t>();
+    const __m256 scale = _mm256_set1_ps(float(scaler));
+    const __m256 fullScale = _mm256_set1_ps(SoapySDR::S16_FULL_SCALE);
+    const __m256 maxValue = _mm256_set1_ps(INT16_MAX);
+    size_t i = 0;
+    for (; i+16 <= n; i += 16)
+    {
+        const __m256 in0 = _mm256_mul_ps(_mm256_mul_ps(_mm256_loadu_ps(src+i+0), scale), fullScale);
+        const __m256 in1 = _mm256_mul_ps(_mm256_mul_ps(_mm256_loadu_ps(src+i+8), scale), fullScale);
+        //packs operates per 128-bit lane, restore the sample order with a permute
+        const __m256i out = _mm256_packs_epi32(avx2CvtPS<false>(in0, maxValue), avx2CvtPS<false>(in1, maxValue));
+        _mm256_storeu_si256((__m256i *)(dst+i), _mm256_shuffle_epi8(_mm256_permute4x64_epi64(out, 0xd8), mask));
+    }
+    for (; i < n; i++) dst[i] = SoapySDR::S16toS16BE(SoapySDR::F32toS16(src[i] * scaler));
+}
+
+//! Select the kernel for the widest extension supported by the host
+#define selectKernel(...) \
+    (getCPUFeatures().avx512bw?&avx512 ## __VA_ARGS__: \
+    (getCPUFeatures().avx2?&avx2 ## __VA_ARGS__:&sse41 ## __VA_ARGS__))
+
+//! Select between the AVX-512 and AVX2 kernels for when SSE4.1 is not provided
+#define selectKernelAVX2Min(...) \
+    (getCPUFeatures().avx512bw?&avx512 ## __VA_ARGS__:&avx2 ## __VA_ARGS__)
+
+//! Select between the AVX2 and SSE4.1 kernels for when AVX-512 offers no gain
+#define selectKernelAVX2(...) \
+    (getCPUFeatures().avx2?&avx2 ## __VA_ARGS__:&sse41 ## __VA_ARGS__)
+
+//! Select between the AVX-512 and SSE4.1 kernels for when AVX2 offers no gain
+#define selectKernelAVX512(...) \
+    (getCPUFeatures().avx512bw?&avx512 ## __VA_ARGS__:&sse41 ## __VA_ARGS__)
+
+#endif //SOAPY_SDR_X86_DISPATCH
+
+/*!
+ * lateLoadVectorizedConverters() is called by lateLoadDefaultConverters().
+ * The host CPU features are detected once, and only the kernels
+ * which the host supports are registered with VECTORIZED priority.
+ */
+void lateLoadVectorizedConverters(void)
+{
+    #ifdef SOAPY_SDR_X86_DISPATCH
+    //SSE4.1 is the minimum extension required by the kernels
+    if (not getCPUFeatures().sse41) return;
+
+    static SoapySDR::ConverterRegistry registerVectorizedS16toF32(SOAPY_SDR_S16, SOAPY_SDR_F32, SoapySDR::ConverterRegistry::VECTORIZED, selectKernel(S16toF32<1, false>));
+    static SoapySDR::ConverterRegistry registerVectorizedF32toS16(SOAPY_SDR_F32, SOAPY_SDR_S16, SoapySDR::ConverterRegistry::VECTORIZED, selectKernel(F32toS16<1, false>));
+    static SoapySDR::ConverterRegistry registerVectorizedS8toF32(SOAPY_SDR_S8, SOAPY_SDR_F32, SoapySDR::ConverterRegistry::VECTORIZED, selectKernel(I8toF32<1, false, false>));
+    static SoapySDR::ConverterRegistry registerVectorizedF32toS8(SOAPY_SDR_F32, SOAPY_SDR_S8, SoapySDR::ConverterRegistry::VECTORIZED, selectKernel(F32toI8<1, false, false>));
+    static SoapySDR::ConverterRegistry registerVectorizedU8toF32(SOAPY_SDR_U8, SOAPY_SDR_F32, SoapySDR::ConverterRegistry::VECTORIZED, selectKernel(I8toF32<1, true, false>));
+    static SoapySDR::ConverterRegistry registerVectorizedF32toU8(SOAPY_SDR_F32, SOAPY_SDR_U8, SoapySDR::ConverterRegistry::VECTORIZED, selectKernel(F32toI8<1, true, false>));
+    static SoapySDR::ConverterRegistry registerVectorizedCS16toCF32(SOAPY_SDR_CS16, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::VECTORIZED, selectKernel(S16toF32<2, false>));
+    static SoapySDR::ConverterRegistry registerVectorizedCF32toCS16(SOAPY_SDR_CF32, SOAPY_SDR_CS16, SoapySDR::ConverterRegistry::VECTORIZED, selectKernel(F32toS16<2, false>));
+    static SoapySDR::ConverterRegistry registerVectorizedCS8toCF32(SOAPY_SDR_CS8, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::VECTORIZED, selectKernel(I8toF32<2, false, false>));
+    static SoapySDR::ConverterRegistry registerVectorizedCF32toCS8(SOAPY_SDR_CF32, SOAPY_SDR_CS8, SoapySDR::ConverterRegistry::VECTORIZED, selectKernel(F32toI8<2, false, false>));
+    static SoapySDR::ConverterRegistry registerVectorizedCU8toCF32(SOAPY_SDR_CU8, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::VECTORIZED, selectKernel(I8toF32<2, true, false>));
+    static SoapySDR::ConverterRegistry registerVectorizedCF32toCU8(SOAPY_SDR_CF32, SOAPY_SDR_CU8, SoapySDR::ConverterRegistry::VECTORIZED, selectKernel(F32toI8<2, true, false>));
+    static SoapySDR::ConverterRegistry registerVectorizedCS12toCS16(SOAPY_SDR_CS12, SOAPY_SDR_CS16, SoapySDR::ConverterRegistry::VECTORIZED, selectKernelAVX2(CS12toCS16));
+    static SoapySDR::ConverterRegistry registerVectorizedCS16toCS12(SOAPY_SDR_CS16, SOAPY_SDR_CS12, SoapySDR::ConverterRegistry::VECTORIZED, &sse41CS16toCS12);
+    static SoapySDR::ConverterRegistry registerVectorizedCS12toCF32(SOAPY_SDR_CS12, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::VECTORIZED, selectKernel(CS12toCF32));
+    static SoapySDR::ConverterRegistry registerVectorizedCF32toCS12(SOAPY_SDR_CF32, SOAPY_SDR_CS12, SoapySDR::ConverterRegistry::VECTORIZED, selectKernel(CF32toCS12<false>));
+    static SoapySDR::ConverterRegistry registerVectorizedCS4toCS8(SOAPY_SDR_CS4, SOAPY_SDR_CS8, SoapySDR::ConverterRegistry::VECTORIZED, &sse41CS4toCS8);
+    static SoapySDR::ConverterRegistry registerVectorizedCS8toCS4(SOAPY_SDR_CS8, SOAPY_SDR_CS4, SoapySDR::ConverterRegistry::VECTORIZED, selectKernelAVX2(CS8toCS4));
+    static SoapySDR::ConverterRegistry registerVectorizedCS4toCF32(SOAPY_SDR_CS4, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::VECTORIZED, selectKernel(CS4toCF32));
+    static SoapySDR::ConverterRegistry registerVectorizedCF32toCS4(SOAPY_SDR_CF32, SOAPY_SDR_CS4, SoapySDR::ConverterRegistry::VECTORIZED, selectKernelAVX512(CF32toCS4));
+    static SoapySDR::ConverterRegistry registerVectorizedDeinterleaveS16toF32(SOAPY_SDR_S16, SOAPY_SDR_F32, SoapySDR::ConverterRegistry::VECTORIZED, selectKernelAVX2(DeinterleaveS16toF32));
+    static SoapySDR::ConverterRegistry registerVectorizedInterleaveF32toS16(SOAPY_SDR_F32, SOAPY_SDR_S16, SoapySDR::ConverterRegistry::VECTORIZED, selectKernelAVX2(InterleaveF32toS16));
+    static SoapySDR::ConverterRegistry registerVectorizedDeinterleaveF32toF32(SOAPY_SDR_F32, SOAPY_SDR_F32, SoapySDR::ConverterRegistry::VECTORIZED, selectKernelAVX2(DeinterleaveF32toF32));
+    static SoapySDR::ConverterRegistry registerVectorizedInterleaveF32toF32(SOAPY_SDR_F32, SOAPY_SDR_F32, SoapySDR::ConverterRegistry::VECTORIZED, selectKernelAVX2(InterleaveF32toF32));
+    static SoapySDR::ConverterRegistry registerSaturatingF32toS16(SOAPY_SDR_F32, SOAPY_SDR_S16, SoapySDR::ConverterRegistry::VECTORIZED, SoapySDR::ConverterRegistry::SATURATING, selectKernel(F32toS16<1, true>));
+    static SoapySDR::ConverterRegistry registerSaturatingF32toS8(SOAPY_SDR_F32, SOAPY_SDR_S8, SoapySDR::ConverterRegistry::VECTORIZED, SoapySDR::ConverterRegistry::SATURATING, selectKernel(F32toI8<1, false, true>));
+    static SoapySDR::ConverterRegistry registerSaturatingF32toU8(SOAPY_SDR_F32, SOAPY_SDR_U8, SoapySDR::ConverterRegistry::VECTORIZED, SoapySDR::ConverterRegistry::SATURATING, selectKernel(F32toI8<1, true, true>));
+    static SoapySDR::ConverterRegistry registerSaturatingCF32toCS16(SOAPY_SDR_CF32, SOAPY_SDR_CS16, SoapySDR::ConverterRegistry::VECTORIZED, SoapySDR::ConverterRegistry::SATURATING, selectKernel(F32toS16<2, true>));
+    static SoapySDR::ConverterRegistry registerSaturatingCF32toCS8(SOAPY_SDR_CF32, SOAPY_SDR_CS8, SoapySDR::ConverterRegistry::VECTORIZED, SoapySDR::ConverterRegistry::SATURATING, selectKernel(F32toI8<2, false, true>));
+    static SoapySDR::ConverterRegistry registerSaturatingCF32toCU8(SOAPY_SDR_CF32, SOAPY_SDR_CU8, SoapySDR::ConverterRegistry::VECTORIZED, SoapySDR::ConverterRegistry::SATURATING, selectKernel(F32toI8<2, true, true>));
+    static SoapySDR::ConverterRegistry registerSaturatingCF32toCS12(SOAPY_SDR_CF32, SOAPY_SDR_CS12, SoapySDR::ConverterRegistry::VECTORIZED, SoapySDR::ConverterRegistry::SATURATING, selectKernel(CF32toCS12<true>));
+    static SoapySDR::ConverterRegistry registerVectorizedCorrectCS16toCF32(SOAPY_SDR_CS16, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::VECTORIZED, selectKernelAVX2(CorrectToCF32<int16_t>));
+    static SoapySDR::ConverterRegistry registerVectorizedCorrectCS8toCF32(SOAPY_SDR_CS8, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::VECTORIZED, selectKernelAVX2(CorrectToCF32<int8_t>));
+    static SoapySDR::ConverterRegistry registerVectorizedCorrectCU8toCF32(SOAPY_SDR_CU8, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::VECTORIZED, selectKernelAVX2(CorrectToCF32<uint8_t>));
+    static SoapySDR::ConverterRegistry registerVectorizedStatisticsCS16toCF32(SOAPY_SDR_CS16, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::VECTORIZED, selectKernelAVX2(StatisticsToCF32<int16_t>));
+    static SoapySDR::ConverterRegistry registerVectorizedStatisticsCS8toCF32(SOAPY_SDR_CS8, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::VECTORIZED, selectKernelAVX2(StatisticsToCF32<int8_t>));
+    static SoapySDR::ConverterRegistry registerVectorizedStatisticsCU8toCF32(SOAPY_SDR_CU8, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::VECTORIZED, selectKernelAVX2(StatisticsToCF32<uint8_t>));
+    static SoapySDR::ConverterRegistry registerStreamingS16toF32(SOAPY_SDR_S16, SOAPY_SDR_F32, SoapySDR::ConverterRegistry::VECTORIZED, SoapySDR::ConverterRegistry::STREAMING, selectKernel(S16toF32<1, true>));
+    static SoapySDR::ConverterRegistry registerStreamingCS16toCF32(SOAPY_SDR_CS16, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::VECTORIZED, SoapySDR::ConverterRegistry::STREAMING, selectKernel(S16toF32<2, true>));
+    static SoapySDR::ConverterRegistry registerStreamingS8toF32(SOAPY_SDR_S8, SOAPY_SDR_F32, SoapySDR::ConverterRegistry::VECTORIZED, SoapySDR::ConverterRegistry::STREAMING, selectKernel(I8toF32<1, false, true>));
+    static SoapySDR::ConverterRegistry registerStreamingCS8toCF32(SOAPY_SDR_CS8, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::VECTORIZED, SoapySDR::ConverterRegistry::STREAMING, selectKernel(I8toF32<2, false, true>));
+    static SoapySDR::ConverterRegistry registerStreamingU8toF32(SOAPY_SDR_U8, SOAPY_SDR_F32, SoapySDR::ConverterRegistry::VECTORIZED, SoapySDR::ConverterRegistry::STREAMING, selectKernel(I8toF32<1, true, true>));
+    static SoapySDR::ConverterRegistry registerStreamingCU8toCF32(SOAPY_SDR_CU8, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::VECTORIZED, SoapySDR::ConverterRegistry::STREAMING, selectKernel(I8toF32<2, true, true>));
+
+    static SoapySDR::ConverterRegistry registerVectorizedS16BEtoS16(SOAPY_SDR_S16BE, SOAPY_SDR_S16, SoapySDR::ConverterRegistry::VECTORIZED, selectKernelAVX2(Swap<int16_t, &SoapySDR::S16BEtoS16, 1, false>));
+    static SoapySDR::ConverterRegistry registerVectorizedS16toS16BE(SOAPY_SDR_S16, SOAPY_SDR_S16BE, SoapySDR::ConverterRegistry::VECTORIZED, selectKernelAVX2(Swap<int16_t, &SoapySDR::S16toS16BE, 1, true>));
+    static SoapySDR::ConverterRegistry registerVectorizedS32BEtoS32(SOAPY_SDR_S32BE, SOAPY_SDR_S32, SoapySDR::ConverterRegistry::VECTORIZED, selectKernelAVX2(Swap<int32_t, &SoapySDR::S32BEtoS32, 1, false>));
+    static SoapySDR::ConverterRegistry registerVectorizedS32toS32BE(SOAPY_SDR_S32, SOAPY_SDR_S32BE, SoapySDR::ConverterRegistry::VECTORIZED, selectKernelAVX2(Swap<int32_t, &SoapySDR::S32toS32BE, 1, true>));
+    static SoapySDR::ConverterRegistry registerVectorizedS16BEtoF32(SOAPY_SDR_S16BE, SOAPY_SDR_F32, SoapySDR::ConverterRegistry::VECTORIZED, selectKernelAVX2(S16BEtoF32<1>));
+    static SoapySDR::ConverterRegistry registerVectorizedF32toS16BE(SOAPY_SDR_F32, SOAPY_SDR_S16BE, SoapySDR::ConverterRegistry::VECTORIZED, selectKernelAVX2(F32toS16BE<1>));
+    static SoapySDR::ConverterRegistry registerVectorizedCS16BEtoCS16(SOAPY_SDR_CS16BE, SOAPY_SDR_CS16, SoapySDR::ConverterRegistry::VECTORIZED, selectKernelAVX2(Swap<int16_t, &SoapySDR::S16BEtoS16, 2, false>));
+    static SoapySDR::ConverterRegistry registerVectorizedCS16toCS16BE(SOAPY_SDR_CS16, SOAPY_SDR_CS16BE, SoapySDR::ConverterRegistry::VECTORIZED, selectKernelAVX2(Swap<int16_t, &SoapySDR::S16toS16BE, 2, true>));
+    static SoapySDR::ConverterRegistry registerVectorizedCS32BEtoCS32(SOAPY_SDR_CS32BE, SOAPY_SDR_CS32, SoapySDR::ConverterRegistry::VECTORIZED, selectKernelAVX2(Swap<int32_t, &SoapySDR::S32BEtoS32, 2, false>));
+    static SoapySDR::ConverterRegistry registerVectorizedCS32toCS32BE(SOAPY_SDR_CS32, SOAPY_SDR_CS32BE, SoapySDR::ConverterRegistry::VECTORIZED, selectKernelAVX2(Swap<int32_t, &SoapySDR::S32toS32BE, 2, true>));
+    static SoapySDR::ConverterRegistry registerVectorizedCS16BEtoCF32(SOAPY_SDR_CS16BE, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::VECTORIZED, selectKernelAVX2(S16BEtoF32<2>));
+    static SoapySDR::ConverterRegistry registerVectorizedCF32toCS16BE(SOAPY_SDR_CF32, SOAPY_SDR_CS16BE, SoapySDR::ConverterRegistry::VECTORIZED, selectKernelAVX2(F32toS16BE<2>));
+
+    //AVX2 is the minimum extension required by the double precision and multi-channel complex kernels
+    if (not getCPUFeatures().avx2) return;
+
+    static SoapySDR::ConverterRegistry registerVectorizedS32toF64(SOAPY_SDR_S32, SOAPY_SDR_F64, SoapySDR::ConverterRegistry::VECTORIZED, selectKernelAVX2Min(IntToF64<int32_t, 1>));
+    static SoapySDR::ConverterRegistry registerVectorizedF64toS32(SOAPY_SDR_F64, SOAPY_SDR_S32, SoapySDR::ConverterRegistry::VECTORIZED, selectKernelAVX2Min(F64toInt<int32_t, 1>));
+    static SoapySDR::ConverterRegistry registerVectorizedS16toF64(SOAPY_SDR_S16, SOAPY_SDR_F64, SoapySDR::ConverterRegistry::VECTORIZED, selectKernelAVX2Min(IntToF64<int16_t, 1>));
+    static SoapySDR::ConverterRegistry registerVectorizedF64toS16(SOAPY_SDR_F64, SOAPY_SDR_S16, SoapySDR::ConverterRegistry::VECTORIZED, selectKernelAVX2Min(F64toInt<int16_t, 1>));
+    static SoapySDR::ConverterRegistry registerVectorizedS8toF64(SOAPY_SDR_S8, SOAPY_SDR_F64, SoapySDR::ConverterRegistry::VECTORIZED, selectKernelAVX2Min(IntToF64<int8_t, 1>));
+    static SoapySDR::ConverterRegistry registerVectorizedF64toS8(SOAPY_SDR_F64, SOAPY_SDR_S8, SoapySDR::ConverterRegistry::VECTORIZED, selectKernelAVX2Min(F64toInt<int8_t, 1>));
+    static SoapySDR::ConverterRegistry registerVectorizedF32toF64(SOAPY_SDR_F32, SOAPY_SDR_F64, SoapySDR::ConverterRegistry::VECTORIZED, selectKernelAVX2Min(F32toF64<1>));
+    static SoapySDR::ConverterRegistry registerVectorizedF64toF32(SOAPY_SDR_F64, SOAPY_SDR_F32, SoapySDR::ConverterRegistry::VECTORIZED, selectKernelAVX2Min(F64toF32<1>));
+    static SoapySDR::ConverterRegistry registerVectorizedCS32toCF64(SOAPY_SDR_CS32, SOAPY_SDR_CF64, SoapySDR::ConverterRegistry::VECTORIZED, selectKernelAVX2Min(IntToF64<int32_t, 2>));
+    static SoapySDR::ConverterRegistry registerVectorizedCF64toCS32(SOAPY_SDR_CF64, SOAPY_SDR_CS32, SoapySDR::ConverterRegistry::VECTORIZED, selectKernelAVX2Min(F64toInt<int32_t, 2>));
+    static SoapySDR::ConverterRegistry registerVectorizedCS16toCF64(SOAPY_SDR_CS16, SOAPY_SDR_CF64, SoapySDR::ConverterRegistry::VECTORIZED, selectKernelAVX2Min(IntToF64<int16_t, 2>));
+    static SoapySDR::ConverterRegistry registerVectorizedCF64toCS16(SOAPY_SDR_CF64, SOAPY_SDR_CS16, SoapySDR::ConverterRegistry::VECTORIZED, selectKernelAVX2Min(F64toInt<int16_t, 2>));
+    static SoapySDR::ConverterRegistry registerVectorizedCS8toCF64(SOAPY_SDR_CS8, SOAPY_SDR_CF64, SoapySDR::ConverterRegistry::VECTORIZED, selectKernelAVX2Min(IntToF64<int8_t, 2>));
+    static SoapySDR::ConverterRegistry registerVectorizedCF64toCS8(SOAPY_SDR_CF64, SOAPY_SDR_CS8, SoapySDR::ConverterRegistry::VECTORIZED, selectKernelAVX2Min(F64toInt<int8_t, 2>));
+    static SoapySDR::ConverterRegistry registerVectorizedCF32toCF64(SOAPY_SDR_CF32, SOAPY_SDR_CF64, SoapySDR::ConverterRegistry::VECTORIZED, selectKernelAVX2Min(F32toF64<2>));
+    static SoapySDR::ConverterRegistry registerVectorizedCF64toCF32(SOAPY_SDR_CF64, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::VECTORIZED, selectKernelAVX2Min(F64toF32<2>));
+    static SoapySDR::ConverterRegistry registerVectorizedInterleaveCS16toCF32(SOAPY_SDR_CS16, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::VECTORIZED, &avx2InterleaveCS16toCF32);
+    static SoapySDR::ConverterRegistry registerVectorizedDeinterleaveCS16toCF32(SOAPY_SDR_CS16, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::VECTORIZED, &avx2DeinterleaveCS16toCF32);
+    static SoapySDR::ConverterRegistry registerVectorizedInterleaveCF32toCS16(SOAPY_SDR_CF32, SOAPY_SDR_CS16, SoapySDR::ConverterRegistry::VECTORIZED, &avx2InterleaveCF32toCS16);
+    static SoapySDR::ConverterRegistry registerVectorizedDeinterleaveCF32toCS16(SOAPY_SDR_CF32, SOAPY_SDR_CS16, SoapySDR::ConverterRegistry::VECTORIZED, &avx2DeinterleaveCF32toCS16);
+    #endif
+}
@@ -281,6 +281,8 @@ def registerLogHandler(handler):
 // Device object
 ////////////////////////////////////////////////////////////////////////
 %nodefaultctor SoapySDR::Device;
+%ignore SoapySDR::Device::startAsyncStream; //the callback runs on a library thread
+%ignore SoapySDR::Device::stopAsyncStream;
 %include <SoapySDR/Device.hpp>
 
 //narrow import * to SOAPY_SDR_ constants
@@ -0,0 +1,165 @@
+// Copyright (c) 2021-2021 Josh Blum
+// SPDX-License-Identifier: BSL-1.0
+
+#include <SoapySDR/Device.hpp>
+#include <SoapySDR/Device.h>
+#include <SoapySDR/Formats.hpp>
+#include <cstdlib>
+#include <cstdio>
+#include <cstdint>
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+//! A device with a CS16 stream and no direct access, which reads a counter, overflows on the third read, and fails from failAt
+class CounterDevice : public SoapySDR::Device
+{
+public:
+    static const size_t MTU = 32;
+
+    size_t getStreamMTU(SoapySDR::Stream *) const
+    {
+        return MTU;
+    }
+
+    int readStream(SoapySDR::Stream *, void * const *buffs, const size_t numElems, int &flags, long long &timeNs, const long)
+    {
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+        const int n = ++numReads;
+        if (failAt != 0 and n >= failAt) return SOAPY_SDR_STREAM_ERROR;
+        if (n == 3) return SOAPY_SDR_OVERFLOW;
+        for (size_t ch = 0; ch < 2; ch++)
+        {
+            auto *out = (int16_t *)buffs[ch];
+            for (size_t i = 0; i < numElems*2; i++) out[i] = int16_t(count+i+ch);
+        }
+        flags = SOAPY_SDR_HAS_TIME;
+        timeNs = count;
+        count += numElems*2;
+        return int(numElems);
+    }
+
+    std::atomic<int> numReads{0};
+    int failAt = 0;
+    size_t count = 0;
+};
+
+//! Check the buffers in order, and record the errors
+struct CallbackChecker
+{
+    void operator()(const void * const *buffs, const int ret, const int flags, const long long timeNs)
+    {
+        numCalls++;
+        if (ret < 0)
+        {
+            if (ret != SOAPY_SDR_OVERFLOW or numBuffs != 2 or buffs != nullptr) ok = false;
+            numOverflows++;
+            return;
+        }
+        if (ret != int(CounterDevice::MTU) or flags != SOAPY_SDR_HAS_TIME or timeNs != expected) ok = false;
+        for (size_t ch = 0; ch < 2; ch++)
+        {
+            const auto *in = (const int16_t *)buffs[ch];
+            for (int i = 0; i < ret*2; i++) if (in[i] != int16_t(expected+i+ch)) ok = false;
+        }
+        expected += ret*2;
+        numBuffs++;
+    }
+
+    std::atomic<int> numCalls{0};
+    int numBuffs = 0;
+    int numOverflows = 0;
+    long long expected = 0;
+    bool ok = true;
+};
+
+static void waitForCalls(const std::atomic<int> &numCalls, const int minCalls)
+{
+    for (int i = 0; i < 1000 and numCalls < minCalls; i++)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+}
+
+static bool checkCallbacks(void)
+{
+    printf("  Check default async stream ... ");
+    CounterDevice device;
+    auto *stream = reinterpret_cast<SoapySDR::Stream *>(&device);
+    CallbackChecker checker;
+    auto callback = [&checker](const void * const *buffs, const int ret, const int flags, const long long timeNs)
+    {
+        checker(buffs, ret, flags, timeNs);
+    };
+    if (device.startAsyncStream(stream, callback, SOAPY_SDR_CS16, 2) != 0) return false;
+    if (device.startAsyncStream(stream, callback, SOAPY_SDR_CS16, 2) != SOAPY_SDR_STREAM_ERROR) return false;
+    waitForCalls(checker.numCalls, 10);
+
+    //the callback is not called after the stop
+    if (device.stopAsyncStream(stream) != 0) return false;
+    const int numCalls = checker.numCalls;
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    if (checker.numCalls != numCalls) return false;
+    if (device.stopAsyncStream(stream) != SOAPY_SDR_STREAM_ERROR) return false;
+
+    //the overflow is delivered in order between the buffers
+    if (not checker.ok or checker.numOverflows != 1 or checker.numBuffs < 9) return false;
+    printf("PASS (%d calls)\n", numCalls);
+    return true;
+}
+
+static bool checkStreamError(void)
+{
+    printf("  Check async stream error ... ");
+    CounterDevice device;
+    device.failAt = 5;
+    auto *stream = reinterpret_cast<SoapySDR::Stream *>(&device);
+    std::atomic<int> numCalls(0);
+    std::atomic<int> lastRet(0);
+    std::atomic<bool> nullBuffs(false);
+    auto callback = [&](const void * const *buffs, const int ret, const int, const long long)
+    {
+        numCalls++;
+        lastRet = ret;
+        nullBuffs = (buffs == nullptr);
+    };
+    if (device.startAsyncStream(stream, callback, SOAPY_SDR_CS16, 2) != 0) return false;
+    waitForCalls(numCalls, 5);
+
+    //the stream error is the last call, and the stream is not read again
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    if (numCalls != 5 or lastRet != SOAPY_SDR_STREAM_ERROR or not nullBuffs or device.numReads != 5) return false;
+    if (device.stopAsyncStream(stream) != 0) return false;
+    printf("PASS\n");
+    return true;
+}
+
+static void countCallback(const void * const *, const int ret, const int, const long long, void *userData)
+{
+    if (ret > 0) (*static_cast<std::atomic<int> *>(userData))++;
+}
+
+static bool checkCallbacksC(void)
+{
+    printf("  Check C async stream ... ");
+    CounterDevice device;
+    auto *cDevice = reinterpret_cast<SoapySDRDevice *>(static_cast<SoapySDR::Device *>(&device));
+    auto *stream = reinterpret_cast<SoapySDRStream *>(&device);
+    std::atomic<int> numCalls(0);
+    if (SoapySDRDevice_startAsyncStream(cDevice, stream, &countCallback, &numCalls, SOAPY_SDR_CS16, 2, 4) != 0) return false;
+    waitForCalls(numCalls, 5);
+    if (SoapySDRDevice_stopAsyncStream(cDevice, stream) != 0) return false;
+    if (numCalls < 5) return false;
+    printf("PASS\n");
+    return true;
+}
+
+int main(void)
+{
+    printf("Check async streams:\n");
+    if (not checkCallbacks()) return EXIT_FAILURE;
+    if (not checkStreamError()) return EXIT_FAILURE;
+    if (not checkCallbacksC()) return EXIT_FAILURE;
+    printf("DONE!\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,1144 @@
+// Copyright (c) 2021-2021 Josh Blum
+// SPDX-License-Identifier: BSL-1.0
+
+#include <SoapySDR/ConverterRegistry.hpp>
+#include <SoapySDR/ConverterPrimitives.hpp>
+#include <SoapySDR/Converters.h>
+#include <SoapySDR/Formats.hpp>
+#include <cstdlib>
+#include <cstdio>
+#include <cstdint>
+#include <cmath>
+#include <vector>
+#include <string>
+#include <thread>
+#include <atomic>
+#include <functional>
+#include <fstream>
+#include <iterator>
+#include <cstring>
+#include <algorithm>
+#include <complex>
+
+//odd number of elements to exercise the remainder loops
+static const size_t NUM_ELEMS = 1021;
+
+//! Read scalar value i of a buffer in the given format
+static double sampleValue(const std::string &format, const void *buff, const size_t i)
+{
+    const std::string type = (format.front() == 'C')?format.substr(1):format;
+    if (type == "F64") return ((const double *)buff)[i];
+    if (type == "F32") return ((const float *)buff)[i];
+    if (type == "S32") return ((const int32_t *)buff)[i];
+    if (type == "U32") return ((const uint32_t *)buff)[i];
+    if (type == "S16") return ((const int16_t *)buff)[i];
+    if (type == "U16") return ((const uint16_t *)buff)[i];
+    if (type == "S8") return ((const int8_t *)buff)[i];
+    if (type == "U8") return ((const uint8_t *)buff)[i];
+
+    //big endian formats are compared in host order
+    if (type == "S32BE") return SoapySDR::S32BEtoS32(((const int32_t *)buff)[i]);
+    if (type == "S16BE") return SoapySDR::S16BEtoS16(((const int16_t *)buff)[i]);
+
+    //packed formats are compared in units of their own LSB
+    if (type == "S12")
+    {
+        int16_t tmp[2];
+        SoapySDR::CS12toCS16(((const uint8_t *)buff)+(i/2)*3, tmp);
+        return tmp[i%2] >> 4;
+    }
+    if (type == "S4")
+    {
+        int8_t tmp[2];
+        SoapySDR::CS4toCS8(((const uint8_t *)buff)[i/2], tmp);
+        return tmp[i%2] >> 4;
+    }
+    return NAN;
+}
+
+//! Fill a buffer with random samples that are within full scale
+static void fillRandom(const std::string &format, std::vector<char> &buff)
+{
+    const std::string type = (format.front() == 'C')?format.substr(1):format;
+    if (type == "F64")
+    {
+        auto *p = (double *)buff.data();
+        for (size_t i = 0; i < buff.size()/sizeof(double); i++) p[i] = (std::rand()/double(RAND_MAX))*1.98 - 0.99;
+    }
+    else if (type == "F32")
+    {
+        auto *p = (float *)buff.data();
+        for (size_t i = 0; i < buff.size()/sizeof(float); i++) p[i] = (std::rand()/float(RAND_MAX))*1.98f - 0.99f;
+    }
+    else for (auto &b : buff) b = char(std::rand());
+}
+
+static bool checkConverter(const std::string &source, const std::string &target, const SoapySDR::ConverterRegistry::FunctionPriority priority, const double scaler)
+{
+    printf("  Check %s -> %s priority %d scaler %g ... ", source.c_str(), target.c_str(), int(priority), scaler);
+    std::vector<char> input(NUM_ELEMS*SoapySDR::formatToSize(source));
+    std::vector<char> expected(NUM_ELEMS*SoapySDR::formatToSize(target));
+    std::vector<char> actual(expected.size());
+    fillRandom(source, input);
+
+    SoapySDR::ConverterRegistry::getFunction(source, target, SoapySDR::ConverterRegistry::GENERIC)(input.data(), expected.data(), NUM_ELEMS, scaler);
+    SoapySDR::ConverterRegistry::getFunction(source, target, priority)(input.data(), actual.data(), NUM_ELEMS, scaler);
+
+    //float targets allow for rounding, integer targets allow for one LSB
+    const bool isFloat = target.find('F') != std::string::npos;
+    const double tolerance = isFloat?1e-6:1.0;
+    const size_t numValues = NUM_ELEMS*((target.front() == 'C')?2:1);
+    for (size_t i = 0; i < numValues; i++)
+    {
+        const double e = sampleValue(target, expected.data(), i);
+        const double a = sampleValue(target, actual.data(), i);
+        if (not (std::abs(e - a) <= tolerance))
+        {
+            printf("FAIL\n");
+            printf("  -> index %d: %f != %f\n", int(i), a, e);
+            return false;
+        }
+    }
+    printf("PASS\n");
+    return true;
+}
+
+//! Check that the saturating converters round and clamp the values beyond full scale
+static bool checkSaturating(const std::string &source, const std::string &target, const SoapySDR::ConverterRegistry::FunctionPriority priority)
+{
+    printf("  Check %s -> %s priority %d saturating ... ", source.c_str(), target.c_str(), int(priority));
+    std::vector<float> input(NUM_ELEMS*2);
+    for (auto &x : input) x = (std::rand()/float(RAND_MAX))*8.0f - 4.0f;
+    std::vector<char> actual(NUM_ELEMS*SoapySDR::formatToSize(target));
+
+    //the scaler leaves half of the values beyond full scale
+    const double scaler = 0.5;
+    SoapySDR::ConverterRegistry::getFunction(source, target, priority, SoapySDR::ConverterRegistry::SATURATING)(input.data(), actual.data(), NUM_ELEMS, scaler);
+
+    const std::string type = (target.front() == 'C')?target.substr(1):target;
+    const double fullScale = (type == "S16")?32768:((type == "S12")?2048:128);
+    const double offset = (type == "U8")?128:0;
+    const size_t numValues = NUM_ELEMS*((target.front() == 'C')?2:1);
+    for (size_t i = 0; i < numValues; i++)
+    {
+        const double e = std::max(-fullScale, std::min(fullScale-1, std::nearbyint(input[i]*scaler*fullScale))) + offset;
+        const double a = sampleValue(target, actual.data(), i);
+        if (not (std::abs(e - a) <= 1.0))
+        {
+            printf("FAIL\n");
+            printf("  -> index %d: %f != %f\n", int(i), a, e);
+            return false;
+        }
+    }
+    printf("PASS\n");
+    return true;
+}
+
+//! Get the minimum or maximum of an integer format in the units of sampleValue()
+static double formatLimit(const std::string &format, const bool isMax)
+{
+    std::string type = (format.front() == 'C')?format.substr(1):format;
+    if (type.size() > 2 and type.substr(type.size()-2) == "BE") type = type.substr(0, type.size()-2);
+    const bool isUnsigned = type.front() == 'U';
+    const int bits = std::stoi(type.substr(1));
+    const double half = std::ldexp(1.0, bits-1);
+    if (isUnsigned) return isMax?(2*half-1):0;
+    return isMax?(half-1):-half;
+}
+
+//! Check that the float to integer converters clamp out of range values like the generic converters
+static bool checkOutOfRange(const std::string &source, const std::string &target, const SoapySDR::ConverterRegistry::FunctionPriority priority, const double scaler)
+{
+    printf("  Check %s -> %s priority %d scaler %g out of range ... ", source.c_str(), target.c_str(), int(priority), scaler);
+    const size_t numValues = NUM_ELEMS*((target.front() == 'C')?2:1);
+    const double specials[] = {1e10, -1e10, 1.0, -1.0, 1.5, -1.5, 2.0001, -2.0001, INFINITY, -INFINITY, NAN};
+    const size_t numSpecials = sizeof(specials)/sizeof(specials[0]);
+    std::vector<double> values(numValues);
+    for (size_t i = 0; i < numValues; i++) values[i] = specials[i%numSpecials];
+
+    std::vector<char> input(NUM_ELEMS*SoapySDR::formatToSize(source));
+    const bool isDouble = source.find("F64") != std::string::npos;
+    for (size_t i = 0; i < numValues; i++)
+    {
+        if (isDouble) ((double *)input.data())[i] = values[i];
+        else ((float *)input.data())[i] = float(values[i]);
+    }
+    std::vector<char> expected(NUM_ELEMS*SoapySDR::formatToSize(target));
+    std::vector<char> actual(expected.size());
+    SoapySDR::ConverterRegistry::getFunction(source, target, SoapySDR::ConverterRegistry::GENERIC)(input.data(), expected.data(), NUM_ELEMS, scaler);
+    SoapySDR::ConverterRegistry::getFunction(source, target, priority)(input.data(), actual.data(), NUM_ELEMS, scaler);
+
+    //full scale and beyond clamps in both directions, and NaN clamps to the minimum
+    for (size_t i = 0; i < numValues; i++)
+    {
+        const double v = values[i]*scaler;
+        const double e = sampleValue(target, expected.data(), i);
+        const double a = sampleValue(target, actual.data(), i);
+        const bool clampsMax = v >= 1.0;
+        const bool clampsMin = v <= -1.0 or std::isnan(v);
+        if ((clampsMax and e != formatLimit(target, true)) or (clampsMin and e != formatLimit(target, false)) or not (std::abs(e - a) <= 1.0))
+        {
+            printf("FAIL\n");
+            printf("  -> index %d value %g: %f != %f\n", int(i), v, a, e);
+            return false;
+        }
+    }
+    printf("PASS\n");
+    return true;
+}
+
+//! Check that MSB aligned samples survive a round trip through a packed format
+static bool checkPackedRoundTrip(const std::string &unpacked, const std::string &packed, const SoapySDR::ConverterRegistry::FunctionPriority priority)
+{
+    printf("  Check %s -> %s -> %s priority %d ... ", unpacked.c_str(), packed.c_str(), unpacked.c_str(), int(priority));
+    std::vector<char> input(NUM_ELEMS*SoapySDR::formatToSize(unpacked));
+    std::vector<char> middle(NUM_ELEMS*SoapySDR::formatToSize(packed));
+    std::vector<char> output(input.size());
+    fillRandom(unpacked, input);
+
+    //clear the low nibble which is not represented by the packed format
+    const size_t wordSize = SoapySDR::formatToSize(unpacked)/2;
+    for (size_t i = 0; i < input.size(); i += wordSize) input[i] &= 0xf0;
+
+    SoapySDR::ConverterRegistry::getFunction(unpacked, packed, priority)(input.data(), middle.data(), NUM_ELEMS, 1.0);
+    SoapySDR::ConverterRegistry::getFunction(packed, unpacked, priority)(middle.data(), output.data(), NUM_ELEMS, 1.0);
+    if (input != output)
+    {
+        printf("FAIL\n");
+        return false;
+    }
+    printf("PASS\n");
+    return true;
+}
+
+//! Read scalar value i of a buffer in the given format, normalized to full scale
+static double normalizedValue(const std::string &format, const void *buff, const size_t i)
+{
+    const std::string type = (format.front() == 'C')?format.substr(1):format;
+    const double value = sampleValue(format, buff, i);
+    if (type.front() == 'F') return value;
+    const double fullScale = std::ldexp(1.0, int(SoapySDR::formatToSize(type)*8-1));
+    return ((type.front() == 'U')?(value - fullScale):value)/fullScale;
+}
+
+//! Check that a converter of the generated matrix scales the normalized values
+static bool checkMatrix(const std::string &source, const std::string &target)
+{
+    printf("  Check %s -> %s matrix ... ", source.c_str(), target.c_str());
+    std::vector<char> input(NUM_ELEMS*SoapySDR::formatToSize(source));
+    std::vector<char> output(NUM_ELEMS*SoapySDR::formatToSize(target));
+    fillRandom(source, input);
+
+    const double scaler = 0.5;
+    SoapySDR::ConverterRegistry::getFunction(source, target, SoapySDR::ConverterRegistry::GENERIC)(input.data(), output.data(), NUM_ELEMS, scaler);
+
+    //truncation loses up to one LSB of the source and of the target
+    double tolerance = 1e-6;
+    for (const auto &format : {source, target})
+    {
+        const std::string type = (format.front() == 'C')?format.substr(1):format;
+        if (type.front() != 'F') tolerance += std::ldexp(1.0, 1-int(SoapySDR::formatToSize(type)*8));
+    }
+    const size_t numValues = NUM_ELEMS*((target.front() == 'C')?2:1);
+    for (size_t i = 0; i < numValues; i++)
+    {
+        const double e = normalizedValue(source, input.data(), i)*scaler;
+        const double a = normalizedValue(target, output.data(), i);
+        if (not (std::abs(e - a) <= tolerance))
+        {
+            printf("FAIL\n");
+            printf("  -> index %d: %f != %f\n", int(i), a, e);
+            return false;
+        }
+    }
+    printf("PASS\n");
+    return true;
+}
+
+//! Check that the table driven path matches the arithmetic path for short buffers
+static bool checkLookupTable(const std::string &source, const std::string &target)
+{
+    printf("  Check %s -> %s lookup table ... ", source.c_str(), target.c_str());
+    const size_t inSize = SoapySDR::formatToSize(source);
+    const size_t outSize = SoapySDR::formatToSize(target);
+    std::vector<char> input(NUM_ELEMS*inSize);
+    std::vector<char> expected(NUM_ELEMS*outSize);
+    std::vector<char> actual(expected.size());
+    fillRandom(source, input);
+
+    //a scaler that no other check uses, so no table is cached yet
+    const double scaler = 0.25;
+    auto converter = SoapySDR::ConverterRegistry::getFunction(source, target, SoapySDR::ConverterRegistry::GENERIC);
+    for (size_t i = 0; i < NUM_ELEMS; i++) converter(input.data()+i*inSize, expected.data()+i*outSize, 1, scaler);
+    converter(input.data(), actual.data(), NUM_ELEMS, scaler);
+    if (expected != actual)
+    {
+        printf("FAIL\n");
+        return false;
+    }
+    printf("PASS\n");
+    return true;
+}
+
+//! Check that the big endian formats hold the most significant byte first
+static bool checkByteOrder(const std::string &target, const SoapySDR::ConverterRegistry::FunctionPriority priority)
+{
+    printf("  Check %s byte order priority %d ... ", target.c_str(), int(priority));
+    const std::string source = target.substr(0, target.size()-2);
+    const size_t wordSize = SoapySDR::formatToSize(source.back() == '2'?"S32":"S16");
+    std::vector<uint8_t> input(NUM_ELEMS*SoapySDR::formatToSize(source));
+    std::vector<uint8_t> output(input.size());
+    for (auto &b : input) b = uint8_t(std::rand());
+
+    const uint16_t one(1);
+    const bool littleEndianHost = *((const uint8_t *)&one) == 1;
+    SoapySDR::ConverterRegistry::getFunction(source, target, priority)(input.data(), output.data(), NUM_ELEMS, 1.0);
+    for (size_t i = 0; i < input.size(); i++)
+    {
+        const size_t j = littleEndianHost?(i - i%wordSize + wordSize-1 - i%wordSize):i;
+        if (output[i] != input[j])
+        {
+            printf("FAIL\n");
+            printf("  -> byte %d: %d != %d\n", int(i), int(output[i]), int(input[j]));
+            return false;
+        }
+    }
+    printf("PASS\n");
+    return true;
+}
+
+//! Check that a converter writes the same output in place as out of place
+static bool checkInPlace(const std::string &source, const std::string &target, const SoapySDR::ConverterRegistry::FunctionPriority priority)
+{
+    printf("  Check %s -> %s priority %d in place ... ", source.c_str(), target.c_str(), int(priority));
+    std::vector<char> input(NUM_ELEMS*SoapySDR::formatToSize(source));
+    std::vector<char> expected(NUM_ELEMS*SoapySDR::formatToSize(target));
+    fillRandom(source, input);
+
+    const auto function = SoapySDR::ConverterRegistry::getFunction(source, target, priority);
+    for (const double scaler : {1.0, 0.5})
+    {
+        auto inPlace = input;
+        function(input.data(), expected.data(), NUM_ELEMS, scaler);
+        function(inPlace.data(), inPlace.data(), NUM_ELEMS, scaler);
+        if (not std::equal(expected.begin(), expected.end(), inPlace.begin()))
+        {
+            printf("FAIL: scaler %g\n", scaler);
+            return false;
+        }
+    }
+    printf("PASS\n");
+    return true;
+}
+
+//! Check in place conversion of a handle, through a multi-hop path and across threads
+static bool checkInPlaceHandle(const std::string &source, const std::string &target)
+{
+    printf("  Check %s -> %s handle in place ... ", source.c_str(), target.c_str());
+    const size_t numElems = NUM_ELEMS*256;
+    std::vector<char> input(numElems*SoapySDR::formatToSize(source));
+    std::vector<char> expected(numElems*SoapySDR::formatToSize(target));
+    fillRandom(source, input);
+
+    SoapySDR::ConverterRegistry::Handle handle(source, target, 0.5);
+    handle.convert(input.data(), expected.data(), numElems);
+    auto inPlace = input;
+    handle.convert(inPlace.data(), inPlace.data(), numElems);
+    auto inPlaceParallel = input;
+    SoapySDR::ConverterRegistry::convertParallel(handle, inPlaceParallel.data(), inPlaceParallel.data(), numElems, 4);
+
+    if (not std::equal(expected.begin(), expected.end(), inPlace.begin()) or
+        not std::equal(expected.begin(), expected.end(), inPlaceParallel.begin()))
+    {
+        printf("FAIL\n");
+        return false;
+    }
+    printf("PASS\n");
+    return true;
+}
+
+//! Check that handles convert like the function they are bound to
+static bool checkHandle(const std::string &source, const std::string &target)
+{
+    printf("  Check %s -> %s handle ... ", source.c_str(), target.c_str());
+    std::vector<char> input(NUM_ELEMS*SoapySDR::formatToSize(source));
+    std::vector<char> expected(NUM_ELEMS*SoapySDR::formatToSize(target));
+    std::vector<char> actual(expected.size());
+    std::vector<char> actualC(expected.size());
+    fillRandom(source, input);
+
+    SoapySDR::ConverterRegistry::getFunction(source, target)(input.data(), expected.data(), NUM_ELEMS, 0.5);
+
+    SoapySDR::ConverterRegistry::Handle handle(source, target);
+    handle.setScaler(0.5);
+    handle.convert(input.data(), actual.data(), NUM_ELEMS);
+
+    auto handleC = SoapySDRConverter_makeHandle(source.c_str(), target.c_str(), 0.5);
+    if (handleC == nullptr)
+    {
+        printf("FAIL: no handle\n");
+        return false;
+    }
+    SoapySDRConverter_convert(handleC, input.data(), actualC.data(), NUM_ELEMS);
+    SoapySDRConverter_freeHandle(handleC);
+
+    if (expected != actual or expected != actualC)
+    {
+        printf("FAIL\n");
+        return false;
+    }
+    printf("PASS\n");
+    return true;
+}
+
+//! A converter that is only registered by the concurrency check
+static void dummyConverter(const void *, void *, const size_t, const double)
+{
+    return;
+}
+
+//! Register converters while other threads are looking them up
+static bool checkConcurrentRegistry(void)
+{
+    printf("  Check registration during lookups ... ");
+    std::atomic<bool> done(false);
+    std::atomic<size_t> failures(0);
+    const auto expected = SoapySDR::ConverterRegistry::getFunction(SOAPY_SDR_CS16, SOAPY_SDR_CF32);
+
+    std::vector<std::thread> readers;
+    for (size_t i = 0; i < 2; i++) readers.emplace_back([&]()
+    {
+        while (not done)
+        {
+            if (SoapySDR::ConverterRegistry::getFunction(SOAPY_SDR_CS16, SOAPY_SDR_CF32) != expected) failures++;
+            if (SoapySDR::ConverterRegistry::listTargetFormats(SOAPY_SDR_CS16).empty()) failures++;
+        }
+    });
+
+    std::vector<SoapySDR::ConverterRegistry> registrations;
+    for (size_t i = 0; i < 64; i++)
+    {
+        registrations.emplace_back("TEST"+std::to_string(i), SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::CUSTOM, &dummyConverter);
+    }
+    done = true;
+    for (auto &reader : readers) reader.join();
+
+    for (size_t i = 0; i < 64; i++)
+    {
+        if (SoapySDR::ConverterRegistry::getFunction("TEST"+std::to_string(i), SOAPY_SDR_CF32) != &dummyConverter) failures++;
+    }
+
+    if (failures != 0)
+    {
+        printf("FAIL: %zu failures\n", size_t(failures));
+        return false;
+    }
+    printf("PASS\n");
+    return true;
+}
+
+//! Register converters from several threads while many threads look them up
+static bool checkRegistryStress(void)
+{
+    printf("  Check registration stress ... ");
+    const size_t numReaders = 4;
+    const size_t numWriters = 2;
+    const size_t numRegistrations = 64;
+    std::atomic<bool> done(false);
+    std::atomic<size_t> failures(0);
+    const auto expected = SoapySDR::ConverterRegistry::getFunction(SOAPY_SDR_CS16, SOAPY_SDR_CF32);
+
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < numReaders; i++) threads.emplace_back([&]()
+    {
+        while (not done)
+        {
+            if (SoapySDR::ConverterRegistry::getFunction(SOAPY_SDR_CS16, SOAPY_SDR_CF32) != expected) failures++;
+            if (SoapySDR::ConverterRegistry::listPriorities(SOAPY_SDR_CF32, SOAPY_SDR_CS16).empty()) failures++;
+            const auto sources = SoapySDR::ConverterRegistry::listAvailableSourceFormats();
+            if (std::find(sources.begin(), sources.end(), SOAPY_SDR_CS16) == sources.end()) failures++;
+        }
+    });
+
+    std::vector<std::thread> writers;
+    for (size_t w = 0; w < numWriters; w++) writers.emplace_back([&, w]()
+    {
+        std::vector<SoapySDR::ConverterRegistry> registrations;
+        for (size_t i = 0; i < numRegistrations; i++)
+        {
+            registrations.emplace_back("STRESS"+std::to_string(w)+"_"+std::to_string(i), SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::CUSTOM, &dummyConverter);
+        }
+    });
+    for (auto &writer : writers) writer.join();
+    done = true;
+    for (auto &thread : threads) thread.join();
+
+    for (size_t w = 0; w < numWriters; w++)
+    {
+        for (size_t i = 0; i < numRegistrations; i++)
+        {
+            if (SoapySDR::ConverterRegistry::getFunction("STRESS"+std::to_string(w)+"_"+std::to_string(i), SOAPY_SDR_CF32) != &dummyConverter) failures++;
+        }
+    }
+
+    if (failures != 0)
+    {
+        printf("FAIL: %zu failures\n", size_t(failures));
+        return false;
+    }
+    printf("PASS\n");
+    return true;
+}
+
+//! Check that chunked parallel conversion matches a single call
+static bool checkParallel(const std::string &source, const std::string &target)
+{
+    printf("  Check %s -> %s parallel ... ", source.c_str(), target.c_str());
+    const size_t numElems = 64*NUM_ELEMS;
+    std::vector<char> input(numElems*SoapySDR::formatToSize(source));
+    std::vector<char> expected(numElems*SoapySDR::formatToSize(target));
+    std::vector<char> actual(expected.size());
+    std::vector<char> actualExec(expected.size());
+    fillRandom(source, input);
+
+    SoapySDR::ConverterRegistry::Handle handle(source, target, 0.5);
+    handle.convert(input.data(), expected.data(), numElems);
+    SoapySDR::ConverterRegistry::convertParallel(handle, input.data(), actual.data(), numElems, 4);
+
+    //concurrent calls share the worker pool
+    std::vector<std::vector<char>> actualShared(3, std::vector<char>(expected.size()));
+    std::vector<std::thread> callers;
+    for (size_t i = 0; i < actualShared.size(); i++) callers.emplace_back([&, i]()
+    {
+        for (size_t n = 0; n < 8; n++) SoapySDR::ConverterRegistry::convertParallel(handle, input.data(), actualShared[i].data(), numElems, 2+i);
+    });
+    for (auto &caller : callers) caller.join();
+    for (const auto &shared : actualShared)
+    {
+        if (shared != expected) actual.clear();
+    }
+
+    size_t numTasks = 0;
+    SoapySDR::ConverterRegistry::convertParallel(handle, input.data(), actualExec.data(), numElems,
+        [&numTasks](const std::vector<std::function<void(void)>> &tasks)
+        {
+            //run in reverse to show that chunks are independent
+            for (auto it = tasks.rbegin(); it != tasks.rend(); ++it) (*it)();
+            numTasks = tasks.size();
+        });
+
+    if (expected != actual or expected != actualExec or numTasks < 2)
+    {
+        printf("FAIL\n");
+        return false;
+    }
+    printf("PASS\n");
+    return true;
+}
+
+//! Compare value i of two buffers, float targets allow for rounding, integer targets allow for one LSB
+static bool checkValue(const std::string &format, const void *expected, const size_t ei, const void *actual, const size_t ai)
+{
+    const double tolerance = (format.find('F') != std::string::npos)?1e-6:1.0;
+    const double e = sampleValue(format, expected, ei);
+    const double a = sampleValue(format, actual, ai);
+    if (std::abs(e - a) <= tolerance) return true;
+    printf("FAIL\n");
+    printf("  -> index %d: %f != %f\n", int(ai), a, e);
+    return false;
+}
+
+//! Check a deinterleaver against the plain converter applied to the interleaved buffer
+static bool checkDeinterleave(const std::string &source, const std::string &target, const size_t numChans, const SoapySDR::ConverterRegistry::FunctionPriority priority)
+{
+    printf("  Check %s -> %s deinterleave %d channels priority %d ... ", source.c_str(), target.c_str(), int(numChans), int(priority));
+    const size_t valuesPerElem = (target.front() == 'C')?2:1;
+    std::vector<char> input(numChans*NUM_ELEMS*SoapySDR::formatToSize(source));
+    std::vector<char> expected(numChans*NUM_ELEMS*SoapySDR::formatToSize(target));
+    std::vector<std::vector<char>> outputs(numChans, std::vector<char>(NUM_ELEMS*SoapySDR::formatToSize(target)));
+    std::vector<void *> outputPtrs;
+    for (auto &output : outputs) outputPtrs.push_back(output.data());
+    fillRandom(source, input);
+
+    SoapySDR::ConverterRegistry::getFunction(source, target, SoapySDR::ConverterRegistry::GENERIC)(input.data(), expected.data(), numChans*NUM_ELEMS, 0.5);
+    SoapySDR::ConverterRegistry::getDeinterleaveFunction(source, target, priority)(input.data(), outputPtrs.data(), numChans, NUM_ELEMS, 0.5);
+
+    for (size_t i = 0; i < NUM_ELEMS; i++)
+    {
+        for (size_t ch = 0; ch < numChans; ch++)
+        {
+            for (size_t j = 0; j < valuesPerElem; j++)
+            {
+                if (not checkValue(target, expected.data(), (i*numChans+ch)*valuesPerElem+j, outputs[ch].data(), i*valuesPerElem+j)) return false;
+            }
+        }
+    }
+    printf("PASS\n");
+    return true;
+}
+
+//! Check an interleaver against the plain converter applied to each planar buffer
+static bool checkInterleave(const std::string &source, const std::string &target, const size_t numChans, const SoapySDR::ConverterRegistry::FunctionPriority priority)
+{
+    printf("  Check %s -> %s interleave %d channels priority %d ... ", source.c_str(), target.c_str(), int(numChans), int(priority));
+    const size_t valuesPerElem = (target.front() == 'C')?2:1;
+    std::vector<std::vector<char>> inputs(numChans, std::vector<char>(NUM_ELEMS*SoapySDR::formatToSize(source)));
+    std::vector<std::vector<char>> expected(numChans, std::vector<char>(NUM_ELEMS*SoapySDR::formatToSize(target)));
+    std::vector<char> output(numChans*NUM_ELEMS*SoapySDR::formatToSize(target));
+    std::vector<const void *> inputPtrs;
+    for (size_t ch = 0; ch < numChans; ch++)
+    {
+        fillRandom(source, inputs[ch]);
+        inputPtrs.push_back(inputs[ch].data());
+        SoapySDR::ConverterRegistry::getFunction(source, target, SoapySDR::ConverterRegistry::GENERIC)(inputs[ch].data(), expected[ch].data(), NUM_ELEMS, 0.5);
+    }
+
+    SoapySDR::ConverterRegistry::getInterleaveFunction(source, target, priority)(inputPtrs.data(), output.data(), numChans, NUM_ELEMS, 0.5);
+
+    for (size_t i = 0; i < NUM_ELEMS; i++)
+    {
+        for (size_t ch = 0; ch < numChans; ch++)
+        {
+            for (size_t j = 0; j < valuesPerElem; j++)
+            {
+                if (not checkValue(target, expected[ch].data(), i*valuesPerElem+j, output.data(), (i*numChans+ch)*valuesPerElem+j)) return false;
+            }
+        }
+    }
+    printf("PASS\n");
+    return true;
+}
+
+//! Check the correction functions against the correction applied after conversion
+static bool checkCorrection(const std::string &source, const SoapySDR::ConverterRegistry::FunctionPriority priority)
+{
+    printf("  Check %s -> CF32 priority %d correction ... ", source.c_str(), int(priority));
+    std::vector<char> input(NUM_ELEMS*SoapySDR::formatToSize(source));
+    std::vector<float> actual(NUM_ELEMS*2);
+    fillRandom(source, input);
+
+    SoapySDR::ConverterRegistry::Correction correction;
+    correction.dcOffset = std::complex<double>(0.01, -0.02);
+    correction.matrix[0][0] = 1.02;
+    correction.matrix[1][0] = 0.05;
+    correction.matrix[1][1] = 0.98;
+    const double scaler = 0.5;
+    SoapySDR::ConverterRegistry::getCorrectionFunction(source, SOAPY_SDR_CF32, priority)(input.data(), actual.data(), NUM_ELEMS, scaler, correction);
+
+    const double fullScale = (source == SOAPY_SDR_CS16)?32768:128;
+    const double offset = (source == SOAPY_SDR_CU8)?128:0;
+    for (size_t i = 0; i < NUM_ELEMS; i++)
+    {
+        const double xI = scaler*(sampleValue(source, input.data(), i*2+0) - offset)/fullScale - correction.dcOffset.real();
+        const double xQ = scaler*(sampleValue(source, input.data(), i*2+1) - offset)/fullScale - correction.dcOffset.imag();
+        const double e[2] = {
+            correction.matrix[0][0]*xI + correction.matrix[0][1]*xQ,
+            correction.matrix[1][0]*xI + correction.matrix[1][1]*xQ};
+        for (size_t j = 0; j < 2; j++)
+        {
+            if (not (std::abs(e[j] - actual[i*2+j]) <= 1e-6))
+            {
+                printf("FAIL\n");
+                printf("  -> index %d: %f != %f\n", int(i*2+j), actual[i*2+j], e[j]);
+                return false;
+            }
+        }
+    }
+    printf("PASS\n");
+    return true;
+}
+
+//! Check that an identity correction set on a handle matches the plain converter
+static bool checkCorrectionHandle(void)
+{
+    printf("  Check correction handle ... ");
+    std::vector<char> input(NUM_ELEMS*SoapySDR::formatToSize(SOAPY_SDR_CS16));
+    std::vector<float> expected(NUM_ELEMS*2), actual(NUM_ELEMS*2);
+    fillRandom(SOAPY_SDR_CS16, input);
+
+    SoapySDR::ConverterRegistry::Correction correction;
+    correction.dcOffset = 0.5;
+    SoapySDR::ConverterRegistry::Handle handle(SOAPY_SDR_CS16, SOAPY_SDR_CF32, correction, 0.5);
+    handle.setCorrection(SoapySDR::ConverterRegistry::Correction());
+    handle.convert(input.data(), actual.data(), NUM_ELEMS);
+    SoapySDR::ConverterRegistry::getFunction(SOAPY_SDR_CS16, SOAPY_SDR_CF32)(input.data(), expected.data(), NUM_ELEMS, 0.5);
+
+    for (size_t i = 0; i < NUM_ELEMS*2; i++)
+    {
+        if (not checkValue(SOAPY_SDR_CF32, expected.data(), i, actual.data(), i)) return false;
+    }
+    printf("PASS\n");
+    return true;
+}
+
+//! Check the converted samples and the statistics against values computed from the input
+static bool checkStatistics(const std::string &source, const SoapySDR::ConverterRegistry::FunctionPriority priority)
+{
+    printf("  Check %s -> CF32 priority %d statistics ... ", source.c_str(), int(priority));
+    std::vector<char> input(NUM_ELEMS*SoapySDR::formatToSize(source));
+    std::vector<float> actual(NUM_ELEMS*2);
+    fillRandom(source, input);
+
+    //clip some of the I and Q values at the limits of the format
+    for (size_t i = 0; i < NUM_ELEMS*2; i += 13)
+    {
+        const bool high = (i%2) == 1;
+        if (source == SOAPY_SDR_CS16) ((int16_t *)input.data())[i] = high?INT16_MAX:INT16_MIN;
+        if (source == SOAPY_SDR_CS8) ((int8_t *)input.data())[i] = high?INT8_MAX:INT8_MIN;
+        if (source == SOAPY_SDR_CU8) ((uint8_t *)input.data())[i] = high?UINT8_MAX:0;
+    }
+
+    const double scaler = 0.5;
+    SoapySDR::ConverterRegistry::Statistics stats;
+    SoapySDR::ConverterRegistry::getStatisticsFunction(source, SOAPY_SDR_CF32, priority)(input.data(), actual.data(), NUM_ELEMS, scaler, stats);
+
+    const double fullScale = (source == SOAPY_SDR_CS16)?32768:128;
+    const double offset = (source == SOAPY_SDR_CU8)?128:0;
+    double peakPower(0.0), sumPower(0.0);
+    size_t clipCount(0);
+    for (size_t i = 0; i < NUM_ELEMS; i++)
+    {
+        const double rawI = sampleValue(source, input.data(), i*2+0) - offset;
+        const double rawQ = sampleValue(source, input.data(), i*2+1) - offset;
+        const double e[2] = {scaler*rawI/fullScale, scaler*rawQ/fullScale};
+        for (size_t j = 0; j < 2; j++)
+        {
+            if (not (std::abs(e[j] - actual[i*2+j]) <= 1e-6))
+            {
+                printf("FAIL\n");
+                printf("  -> index %d: %f != %f\n", int(i*2+j), actual[i*2+j], e[j]);
+                return false;
+            }
+        }
+        const double power = e[0]*e[0] + e[1]*e[1];
+        peakPower = std::max(peakPower, power);
+        sumPower += power;
+        if (std::abs(rawI + 0.5) >= fullScale-0.5 or std::abs(rawQ + 0.5) >= fullScale-0.5) clipCount++;
+    }
+
+    const double peak = std::sqrt(peakPower);
+    const double meanPower = sumPower/NUM_ELEMS;
+    if (not (std::abs(stats.peak - peak) <= 1e-6) or not (std::abs(stats.meanPower - meanPower) <= 1e-6) or stats.clipCount != clipCount)
+    {
+        printf("FAIL\n");
+        printf("  -> peak %f != %f, power %f != %f, clips %d != %d\n",
+            stats.peak, peak, stats.meanPower, meanPower, int(stats.clipCount), int(clipCount));
+        return false;
+    }
+    printf("PASS\n");
+    return true;
+}
+
+//! Check a streaming converter against the plain converter, with a misaligned output
+static bool checkStreaming(const std::string &source, const std::string &target, const SoapySDR::ConverterRegistry::FunctionPriority priority)
+{
+    printf("  Check %s -> %s priority %d streaming ... ", source.c_str(), target.c_str(), int(priority));
+    const size_t numValues = NUM_ELEMS*SoapySDR::formatToSize(target)/sizeof(float);
+    std::vector<char> input(NUM_ELEMS*SoapySDR::formatToSize(source));
+    std::vector<float> expected(numValues), actual(numValues+1);
+    fillRandom(source, input);
+
+    SoapySDR::ConverterRegistry::getFunction(source, target, SoapySDR::ConverterRegistry::GENERIC)(input.data(), expected.data(), NUM_ELEMS, 0.5);
+    SoapySDR::ConverterRegistry::getFunction(source, target, priority, SoapySDR::ConverterRegistry::STREAMING)(input.data(), actual.data()+1, NUM_ELEMS, 0.5);
+    for (size_t i = 0; i < numValues; i++)
+    {
+        if (not checkValue(target, expected.data(), i, actual.data()+1, i)) return false;
+    }
+    printf("PASS\n");
+    return true;
+}
+
+//! Check that a handle switches to the streaming converter at the threshold
+static bool checkStreamingHandle(void)
+{
+    printf("  Check streaming handle ... ");
+    std::vector<char> input(NUM_ELEMS*SoapySDR::formatToSize(SOAPY_SDR_CS16));
+    std::vector<float> expected(NUM_ELEMS*2), actual(NUM_ELEMS*2);
+    fillRandom(SOAPY_SDR_CS16, input);
+
+    SoapySDR::ConverterRegistry::Handle handle(SOAPY_SDR_CS16, SOAPY_SDR_CF32, 0.5);
+    handle.convert(input.data(), expected.data(), NUM_ELEMS);
+    handle.setStreamingThreshold(64*sizeof(float)*2);
+    const bool available = not SoapySDR::ConverterRegistry::listPriorities(SOAPY_SDR_CS16, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::STREAMING).empty();
+    if (handle.getStreamingThreshold() != 64*sizeof(float)*2 or
+        handle.isStreaming(NUM_ELEMS) != available or handle.isStreaming(63) or
+        (available and not handle.isStreaming(64)))
+    {
+        printf("FAIL: threshold\n");
+        return false;
+    }
+    handle.convert(input.data(), actual.data(), NUM_ELEMS);
+    if (expected != actual)
+    {
+        printf("FAIL\n");
+        return false;
+    }
+    handle.setStreamingThreshold(0);
+    if (handle.isStreaming(NUM_ELEMS))
+    {
+        printf("FAIL: disable\n");
+        return false;
+    }
+    printf("PASS\n");
+    return true;
+}
+
+//! A copy which is fast to time for autotune
+static void fastCopy(const void *srcBuff, void *dstBuff, const size_t numElems, const double)
+{
+    std::memcpy(dstBuff, srcBuff, numElems*4);
+}
+
+//! A copy which autotune should never pick over fastCopy()
+static void slowCopy(const void *srcBuff, void *dstBuff, const size_t numElems, const double)
+{
+    for (size_t i = 0; i < 100; i++)
+    {
+        for (size_t j = 0; j < numElems*4; j++) ((volatile char *)dstBuff)[j] = ((const char *)srcBuff)[j];
+    }
+}
+
+//! Check that autotune prefers the faster converter over the higher priority
+static bool checkAutotune(void)
+{
+    printf("  Check autotune selection ... ");
+    const char *cachePath = "TestConverters.autotune";
+    std::remove(cachePath);
+    static SoapySDR::ConverterRegistry registerFast32("TUNEIN32", "TUNEOUT32", SoapySDR::ConverterRegistry::GENERIC, &fastCopy);
+    static SoapySDR::ConverterRegistry registerSlow32("TUNEIN32", "TUNEOUT32", SoapySDR::ConverterRegistry::CUSTOM, &slowCopy);
+    static SoapySDR::ConverterRegistry registerFast16("TUNEX32", "TUNEY32", SoapySDR::ConverterRegistry::GENERIC, &fastCopy);
+    static SoapySDR::ConverterRegistry registerSlow16("TUNEX32", "TUNEY32", SoapySDR::ConverterRegistry::CUSTOM, &slowCopy);
+
+    SoapySDR::ConverterRegistry::setAutotune(true);
+    const bool tuned = SoapySDR::ConverterRegistry::getFunction("TUNEIN32", "TUNEOUT32") == &fastCopy;
+    SoapySDR::ConverterRegistry::setAutotuneCache(cachePath);
+    const bool tunedCached = SoapySDR::ConverterRegistry::getFunction("TUNEX32", "TUNEY32") == &fastCopy;
+    SoapySDR::ConverterRegistry::setAutotuneCache("");
+    SoapySDR::ConverterRegistry::setAutotune(false);
+    const bool untuned = SoapySDR::ConverterRegistry::getFunction("TUNEIN32", "TUNEOUT32") == &slowCopy;
+
+    std::ifstream cacheFile(cachePath);
+    const std::string cacheContents((std::istreambuf_iterator<char>(cacheFile)), std::istreambuf_iterator<char>());
+    const bool cached = cacheContents.find("\tTUNEX32\tTUNEY32\t0\n") != std::string::npos;
+    cacheFile.close();
+    std::remove(cachePath);
+
+    if (not tuned or not tunedCached or not untuned or not cached)
+    {
+        printf("FAIL\n");
+        return false;
+    }
+    printf("PASS\n");
+    return true;
+}
+
+//! Check that the lookups by format descriptor match the lookups by format string
+static bool checkDescriptorLookup(void)
+{
+    printf("  Check lookup by format descriptor ... ");
+    for (const auto &source : SoapySDR::ConverterRegistry::listAvailableSourceFormats())
+    {
+        for (const auto &target : SoapySDR::ConverterRegistry::listTargetFormats(source))
+        {
+            const auto function = SoapySDR::ConverterRegistry::getFunction(SoapySDR::formatToDescriptor(source), SoapySDR::formatToDescriptor(target));
+            if (function != SoapySDR::ConverterRegistry::getFunction(source, target))
+            {
+                printf("FAIL: %s -> %s\n", source.c_str(), target.c_str());
+                return false;
+            }
+        }
+    }
+
+    //a higher priority registration replaces the indexed converter
+    const auto source = SoapySDR::formatToDescriptor("DESCIN32");
+    const auto target = SoapySDR::formatToDescriptor("DESCOUT32");
+    static SoapySDR::ConverterRegistry registerGeneric("DESCIN32", "DESCOUT32", SoapySDR::ConverterRegistry::GENERIC, &fastCopy);
+    const bool indexed = SoapySDR::ConverterRegistry::getFunction(source, target) == &fastCopy;
+    static SoapySDR::ConverterRegistry registerCustom("DESCIN32", "DESCOUT32", SoapySDR::ConverterRegistry::CUSTOM, &slowCopy);
+    const bool reindexed = SoapySDR::ConverterRegistry::getFunction(source, target) == &slowCopy;
+
+    //autotune results apply to the descriptor lookups
+    SoapySDR::ConverterRegistry::setAutotune(true);
+    const bool tuned = SoapySDR::ConverterRegistry::getFunction(SoapySDR::formatToDescriptor("TUNEIN32"), SoapySDR::formatToDescriptor("TUNEOUT32")) == &fastCopy;
+    SoapySDR::ConverterRegistry::setAutotune(false);
+
+    bool threw = false;
+    try
+    {
+        SoapySDR::ConverterRegistry::getFunction(target, source);
+    }
+    catch (const std::exception &)
+    {
+        threw = true;
+    }
+
+    if (not indexed or not reindexed or not tuned or not threw)
+    {
+        printf("FAIL\n");
+        return false;
+    }
+    printf("PASS\n");
+    return true;
+}
+
+static std::atomic<size_t> numCountedCalls(0);
+
+static void countedCopy(const void *srcBuff, void *dstBuff, const size_t numElems, const double)
+{
+    numCountedCalls++;
+    std::memcpy(dstBuff, srcBuff, numElems*4);
+}
+
+//! Check that a handle without a direct converter chains converters along a path
+static bool checkPath(void)
+{
+    printf("  Check CS12 -> CF64 path ... ");
+    const auto direct = SoapySDR::ConverterRegistry::getPath(SOAPY_SDR_CS16, SOAPY_SDR_CF32);
+    const auto path = SoapySDR::ConverterRegistry::getPath(SOAPY_SDR_CS12, SOAPY_SDR_CF64);
+    const auto none = SoapySDR::ConverterRegistry::getPath(SOAPY_SDR_CS16, "FOO");
+    if (direct.size() != 2 or path.size() != 3 or path.front() != SOAPY_SDR_CS12 or path.back() != SOAPY_SDR_CF64 or not none.empty())
+    {
+        printf("FAIL: unexpected path\n");
+        return false;
+    }
+
+    //formats of unknown size are only converted directly, never staged along a path
+    static SoapySDR::ConverterRegistry registerInto(SOAPY_SDR_CS16, "UNSIZED", SoapySDR::ConverterRegistry::GENERIC, &countedCopy);
+    static SoapySDR::ConverterRegistry registerOutOf("UNSIZED", SOAPY_SDR_CS8, SoapySDR::ConverterRegistry::GENERIC, &countedCopy);
+    const auto unsized = SoapySDR::ConverterRegistry::getPath(SOAPY_SDR_CS16, "UNSIZED");
+    const auto through = SoapySDR::ConverterRegistry::getPath("UNSIZED", SOAPY_SDR_CF32);
+    if (unsized.size() != 2 or not through.empty())
+    {
+        printf("FAIL: path through format of unknown size\n");
+        return false;
+    }
+
+    //span several scratch blocks
+    const size_t numElems = 16*NUM_ELEMS;
+    std::vector<char> input(numElems*SoapySDR::formatToSize(SOAPY_SDR_CS12));
+    std::vector<char> tmp(numElems*SoapySDR::formatToSize(SOAPY_SDR_CF32));
+    std::vector<char> expected(numElems*SoapySDR::formatToSize(SOAPY_SDR_CF64));
+    std::vector<char> actual(expected.size());
+    fillRandom(SOAPY_SDR_CS12, input);
+
+    SoapySDR::ConverterRegistry::getFunction(SOAPY_SDR_CS12, SOAPY_SDR_CF32)(input.data(), tmp.data(), numElems, 0.5);
+    SoapySDR::ConverterRegistry::getFunction(SOAPY_SDR_CF32, SOAPY_SDR_CF64)(tmp.data(), expected.data(), numElems, 1.0);
+    SoapySDR::ConverterRegistry::Handle handle(SOAPY_SDR_CS12, SOAPY_SDR_CF64, 0.5);
+    handle.convert(input.data(), actual.data(), numElems);
+
+    for (size_t i = 0; i < numElems*2; i++)
+    {
+        if (not checkValue(SOAPY_SDR_CF64, expected.data(), i, actual.data(), i)) return false;
+    }
+    printf("PASS\n");
+    return true;
+}
+
+//! Check that autotune times each path edge once, and reuses the cost in later paths
+static bool checkPathAutotune(void)
+{
+    printf("  Check path autotune ... ");
+    static SoapySDR::ConverterRegistry registerFirst("HOPA32", "HOPB32", SoapySDR::ConverterRegistry::GENERIC, &countedCopy);
+    static SoapySDR::ConverterRegistry registerSecond("HOPB32", "HOPC32", SoapySDR::ConverterRegistry::GENERIC, &countedCopy);
+    const std::vector<std::string> expected({"HOPA32", "HOPB32", "HOPC32"});
+
+    SoapySDR::ConverterRegistry::setAutotune(true);
+    const bool first = SoapySDR::ConverterRegistry::getPath("HOPA32", "HOPC32") == expected;
+    const size_t firstCalls = numCountedCalls.exchange(0);
+    const bool second = SoapySDR::ConverterRegistry::getPath("HOPA32", "HOPC32") == expected;
+    const size_t secondCalls = numCountedCalls.exchange(0);
+    SoapySDR::ConverterRegistry::setAutotune(false);
+
+    if (not first or not second or firstCalls == 0 or secondCalls != 0)
+    {
+        printf("FAIL: %zu then %zu timed calls\n", firstCalls, secondCalls);
+        return false;
+    }
+    printf("PASS\n");
+    return true;
+}
+
+int main(void)
+{
+    printf("Check converter handles:\n");
+    if (not checkHandle(SOAPY_SDR_CS16, SOAPY_SDR_CF32)) return EXIT_FAILURE;
+    if (not checkHandle(SOAPY_SDR_CF32, SOAPY_SDR_CS12)) return EXIT_FAILURE;
+    if (SoapySDRConverter_makeHandle("CS16", "FOO", 1.0) != nullptr) return EXIT_FAILURE;
+
+    printf("Check generated converter matrix:\n");
+    for (const std::string prefix : {"", "C"})
+    {
+        for (const std::string source : {"F64", "F32", "S32", "U32", "S16", "U16", "S8", "U8"})
+        {
+            for (const std::string target : {"F64", "F32", "S32", "U32", "S16", "U16", "S8", "U8"})
+            {
+                if (not checkMatrix(prefix+source, prefix+target)) return EXIT_FAILURE;
+            }
+        }
+    }
+
+    printf("Check lookup tables:\n");
+    if (not checkLookupTable(SOAPY_SDR_CU8, SOAPY_SDR_CF32)) return EXIT_FAILURE;
+    if (not checkLookupTable(SOAPY_SDR_CS8, SOAPY_SDR_CF32)) return EXIT_FAILURE;
+    if (not checkLookupTable(SOAPY_SDR_CS8, SOAPY_SDR_CF64)) return EXIT_FAILURE;
+    if (not checkLookupTable(SOAPY_SDR_CU8, SOAPY_SDR_CF64)) return EXIT_FAILURE;
+
+    printf("Check packed formats:\n");
+    for (const auto priority : SoapySDR::ConverterRegistry::listPriorities(SOAPY_SDR_CS16, SOAPY_SDR_CS12))
+    {
+        if (not checkPackedRoundTrip(SOAPY_SDR_CS16, SOAPY_SDR_CS12, priority)) return EXIT_FAILURE;
+    }
+    for (const auto priority : SoapySDR::ConverterRegistry::listPriorities(SOAPY_SDR_CS8, SOAPY_SDR_CS4))
+    {
+        if (not checkPackedRoundTrip(SOAPY_SDR_CS8, SOAPY_SDR_CS4, priority)) return EXIT_FAILURE;
+    }
+
+    printf("Check big endian formats:\n");
+    for (const std::string target : {SOAPY_SDR_S16BE, SOAPY_SDR_S32BE, SOAPY_SDR_CS16BE, SOAPY_SDR_CS32BE})
+    {
+        const auto priorities = SoapySDR::ConverterRegistry::listPriorities(target.substr(0, target.size()-2), target);
+        if (priorities.empty()) return EXIT_FAILURE;
+        for (const auto priority : priorities)
+        {
+            if (not checkByteOrder(target, priority)) return EXIT_FAILURE;
+        }
+    }
+
+    printf("Check converters against generic implementation:\n");
+    for (const auto &source : SoapySDR::ConverterRegistry::listAvailableSourceFormats())
+    {
+        for (const auto &target : SoapySDR::ConverterRegistry::listTargetFormats(source))
+        {
+            for (const auto priority : SoapySDR::ConverterRegistry::listPriorities(source, target))
+            {
+                if (priority == SoapySDR::ConverterRegistry::GENERIC) continue;
+                if (not checkConverter(source, target, priority, 1.0)) return EXIT_FAILURE;
+                if (not checkConverter(source, target, priority, 0.5)) return EXIT_FAILURE;
+            }
+        }
+    }
+
+    printf("Check in place conversion:\n");
+    for (const auto &source : SoapySDR::ConverterRegistry::listAvailableSourceFormats())
+    {
+        for (const auto &target : SoapySDR::ConverterRegistry::listTargetFormats(source))
+        {
+            const bool smaller = SoapySDR::formatToSize(target) <= SoapySDR::formatToSize(source);
+            if (SoapySDR::ConverterRegistry::supportsInPlace(source, target) != smaller) return EXIT_FAILURE;
+            if (not smaller) continue;
+            for (const auto priority : SoapySDR::ConverterRegistry::listPriorities(source, target))
+            {
+                if (not checkInPlace(source, target, priority)) return EXIT_FAILURE;
+            }
+        }
+    }
+    if (not checkInPlaceHandle(SOAPY_SDR_CF32, SOAPY_SDR_CS16)) return EXIT_FAILURE;
+    if (not checkInPlaceHandle(SOAPY_SDR_CS16BE, SOAPY_SDR_CS8)) return EXIT_FAILURE;
+    if (not checkInPlaceHandle(SOAPY_SDR_CS16, SOAPY_SDR_CS16BE)) return EXIT_FAILURE;
+
+    printf("Check saturating converters:\n");
+    for (const std::string target : {SOAPY_SDR_S16, SOAPY_SDR_S8, SOAPY_SDR_U8, SOAPY_SDR_CS16, SOAPY_SDR_CS8, SOAPY_SDR_CU8, SOAPY_SDR_CS12})
+    {
+        const std::string source = (target.front() == 'C')?SOAPY_SDR_CF32:SOAPY_SDR_F32;
+        const auto priorities = SoapySDR::ConverterRegistry::listPriorities(source, target, SoapySDR::ConverterRegistry::SATURATING);
+        if (priorities.empty()) return EXIT_FAILURE;
+        for (const auto priority : priorities)
+        {
+            if (not checkSaturating(source, target, priority)) return EXIT_FAILURE;
+        }
+    }
+    if (SoapySDRConverter_getFunctionWithVariant(SOAPY_SDR_CS16, SOAPY_SDR_CF32, SOAPY_SDR_CONVERTER_SATURATING) != nullptr) return EXIT_FAILURE;
+
+    printf("Check out of range float to integer conversion:\n");
+    for (const std::string source : {SOAPY_SDR_F32, SOAPY_SDR_CF32, SOAPY_SDR_F64, SOAPY_SDR_CF64})
+    {
+        for (const auto &target : SoapySDR::ConverterRegistry::listTargetFormats(source))
+        {
+            if (target.find('F') != std::string::npos) continue;
+            for (const auto priority : SoapySDR::ConverterRegistry::listPriorities(source, target))
+            {
+                if (not checkOutOfRange(source, target, priority, 1.0)) return EXIT_FAILURE;
+                if (not checkOutOfRange(source, target, priority, 0.5)) return EXIT_FAILURE;
+            }
+        }
+    }
+
+    printf("Check streaming converters:\n");
+    for (const std::string source : {SOAPY_SDR_S16, SOAPY_SDR_S8, SOAPY_SDR_U8, SOAPY_SDR_CS16, SOAPY_SDR_CS8, SOAPY_SDR_CU8})
+    {
+        const std::string target = (source.front() == 'C')?SOAPY_SDR_CF32:SOAPY_SDR_F32;
+        for (const auto priority : SoapySDR::ConverterRegistry::listPriorities(source, target, SoapySDR::ConverterRegistry::STREAMING))
+        {
+            if (not checkStreaming(source, target, priority)) return EXIT_FAILURE;
+        }
+    }
+    if (not checkStreamingHandle()) return EXIT_FAILURE;
+
+    printf("Check correction converters:\n");
+    for (const std::string source : {SOAPY_SDR_CS16, SOAPY_SDR_CS8, SOAPY_SDR_CU8})
+    {
+        const auto priorities = SoapySDR::ConverterRegistry::listCorrectionPriorities(source, SOAPY_SDR_CF32);
+        if (priorities.empty()) return EXIT_FAILURE;
+        for (const auto priority : priorities)
+        {
+            if (not checkCorrection(source, priority)) return EXIT_FAILURE;
+        }
+    }
+    if (not checkCorrectionHandle()) return EXIT_FAILURE;
+
+    printf("Check statistics converters:\n");
+    for (const std::string source : {SOAPY_SDR_CS16, SOAPY_SDR_CS8, SOAPY_SDR_CU8})
+    {
+        const auto priorities = SoapySDR::ConverterRegistry::listStatisticsPriorities(source, SOAPY_SDR_CF32);
+        if (priorities.empty()) return EXIT_FAILURE;
+        for (const auto priority : priorities)
+        {
+            if (not checkStatistics(source, priority)) return EXIT_FAILURE;
+        }
+    }
+
+    printf("Check deinterleave and interleave:\n");
+    std::vector<std::pair<std::string, std::string>> interleavedFormats;
+    for (const std::string prefix : {"", "C"})
+    {
+        interleavedFormats.emplace_back(prefix+"F32", prefix+"F32");
+        interleavedFormats.emplace_back(prefix+"S16", prefix+"S16");
+        for (const std::string type : {"S16", "S8", "U8"})
+        {
+            interleavedFormats.emplace_back(prefix+type, prefix+"F32");
+            interleavedFormats.emplace_back(prefix+"F32", prefix+type);
+        }
+    }
+    for (const auto &formats : interleavedFormats)
+    {
+        for (size_t numChans = 1; numChans <= 4; numChans++)
+        {
+            for (const auto priority : SoapySDR::ConverterRegistry::listDeinterleavePriorities(formats.first, formats.second))
+            {
+                if (not checkDeinterleave(formats.first, formats.second, numChans, priority)) return EXIT_FAILURE;
+            }
+            for (const auto priority : SoapySDR::ConverterRegistry::listInterleavePriorities(formats.first, formats.second))
+            {
+                if (not checkInterleave(formats.first, formats.second, numChans, priority)) return EXIT_FAILURE;
+            }
+        }
+    }
+
+    printf("Check converter paths:\n");
+    if (not checkPath()) return EXIT_FAILURE;
+    if (not checkPathAutotune()) return EXIT_FAILURE;
+
+    printf("Check parallel conversion:\n");
+    if (not checkParallel(SOAPY_SDR_CS16, SOAPY_SDR_CF32)) return EXIT_FAILURE;
+    if (not checkParallel(SOAPY_SDR_CF32, SOAPY_SDR_CS12)) return EXIT_FAILURE;
+
+    //registers test formats, so run after the listing checks above
+    printf("Check converter registry:\n");
+    if (not checkConcurrentRegistry()) return EXIT_FAILURE;
+    if (not checkRegistryStress()) return EXIT_FAILURE;
+    if (not checkAutotune()) return EXIT_FAILURE;
+    if (not checkDescriptorLookup()) return EXIT_FAILURE;
+
+    printf("DONE!\n");
+    return EXIT_SUCCESS;
+}
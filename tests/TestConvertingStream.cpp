@@ -0,0 +1,178 @@
+// Copyright (c) 2021-2021 Josh Blum
+// SPDX-License-Identifier: BSL-1.0
+
+#include <SoapySDR/ConvertingStream.hpp>
+#include <SoapySDR/Formats.hpp>
+#include <cstdlib>
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+
+//! A device with a native CS16 stream of 12-bit samples, which records the transmitted samples
+class LoopbackDevice : public SoapySDR::Device
+{
+public:
+    static const size_t MTU = 256;
+
+    std::string getNativeStreamFormat(const int, const size_t, double &fullScale) const
+    {
+        fullScale = 2048;
+        return SOAPY_SDR_CS16;
+    }
+
+    SoapySDR::Stream *setupStream(const int, const std::string &format, const std::vector<size_t> &channels, const SoapySDR::Kwargs &)
+    {
+        if (format != SOAPY_SDR_CS16) throw std::runtime_error("LoopbackDevice::setupStream() only CS16");
+        numChans = channels.empty()?1:channels.size();
+        written.assign(numChans, std::vector<int16_t>());
+        numOpen++;
+        return reinterpret_cast<SoapySDR::Stream *>(this);
+    }
+
+    void closeStream(SoapySDR::Stream *)
+    {
+        numOpen--;
+    }
+
+    size_t getStreamMTU(SoapySDR::Stream *) const
+    {
+        return MTU;
+    }
+
+    //each channel reads a ramp of I values from -2048 with Q = channel
+    int readStream(SoapySDR::Stream *, void * const *buffs, const size_t numElems, int &flags, long long &timeNs, const long)
+    {
+        if (numElems > MTU) return SOAPY_SDR_STREAM_ERROR;
+        for (size_t ch = 0; ch < numChans; ch++)
+        {
+            auto *out = (int16_t *)buffs[ch];
+            for (size_t i = 0; i < numElems; i++)
+            {
+                out[i*2+0] = int16_t(int(i*16)-2048);
+                out[i*2+1] = int16_t(ch);
+            }
+        }
+        flags = SOAPY_SDR_HAS_TIME;
+        timeNs = 1000;
+        return int(numElems);
+    }
+
+    int writeStream(SoapySDR::Stream *, const void * const *buffs, const size_t numElems, int &flags, const long long, const long)
+    {
+        if (numElems > MTU) return SOAPY_SDR_STREAM_ERROR;
+        for (size_t ch = 0; ch < numChans; ch++)
+        {
+            const auto *in = (const int16_t *)buffs[ch];
+            written[ch].insert(written[ch].end(), in, in+numElems*2);
+        }
+        lastFlags = flags;
+        return int(numElems);
+    }
+
+    size_t numChans = 0;
+    int numOpen = 0;
+    int lastFlags = 0;
+    std::vector<std::vector<int16_t>> written;
+};
+
+static bool checkRead(LoopbackDevice &device)
+{
+    printf("  Check CF32 read ... ");
+    SoapySDR::ConvertingStream stream(&device, SOAPY_SDR_RX, SOAPY_SDR_CF32, {0, 1});
+    if (not stream.isConverting() or stream.getNativeFormat() != SOAPY_SDR_CS16) return false;
+
+    //more than the MTU is read one MTU at a time
+    std::vector<float> buff0(1000*2), buff1(1000*2);
+    void *buffs[] = {buff0.data(), buff1.data()};
+    int flags(0);
+    long long timeNs(0);
+    const int ret = stream.readStream(buffs, 1000, flags, timeNs);
+    if (ret != int(LoopbackDevice::MTU) or flags != SOAPY_SDR_HAS_TIME or timeNs != 1000) return false;
+
+    //the native full scale of 2048 maps to 1.0
+    for (int i = 0; i < ret; i++)
+    {
+        const float expected = (i*16-2048)/2048.0f;
+        if (buff0[i*2] != expected or buff1[i*2] != expected) return false;
+        if (buff0[i*2+1] != 0.0f or buff1[i*2+1] != 1.0f/2048) return false;
+    }
+    printf("PASS\n");
+    return true;
+}
+
+static bool checkWrite(LoopbackDevice &device)
+{
+    printf("  Check CS8 write ... ");
+    SoapySDR::ConvertingStream stream(&device, SOAPY_SDR_TX, SOAPY_SDR_CS8);
+    std::vector<int8_t> buff(300*2);
+    for (size_t i = 0; i < buff.size(); i++) buff[i] = int8_t(i);
+    const void *buffs[] = {buff.data()};
+
+    //the end of burst is held back until the last element is written
+    int flags(SOAPY_SDR_END_BURST);
+    int ret = stream.writeStream(buffs, 300, flags);
+    if (ret != int(LoopbackDevice::MTU) or device.lastFlags != 0) return false;
+    buffs[0] = buff.data()+ret*2;
+    flags = SOAPY_SDR_END_BURST;
+    ret = stream.writeStream(buffs, 300-ret, flags);
+    if (ret != 300-int(LoopbackDevice::MTU) or device.lastFlags != SOAPY_SDR_END_BURST) return false;
+
+    //the CS8 full scale of 128 maps to the native full scale of 2048
+    const auto &written = device.written[0];
+    if (written.size() != buff.size()) return false;
+    for (size_t i = 0; i < buff.size(); i++)
+    {
+        if (written[i] != buff[i]*16) return false;
+    }
+    printf("PASS\n");
+    return true;
+}
+
+static bool checkPassThrough(LoopbackDevice &device)
+{
+    printf("  Check native CS16 read ... ");
+    SoapySDR::ConvertingStream stream(&device, SOAPY_SDR_RX, SOAPY_SDR_CS16);
+    if (stream.isConverting()) return false;
+
+    //the device returns an error for more than the MTU when nothing is in between
+    std::vector<int16_t> buff(1000*2);
+    void *buffs[] = {buff.data()};
+    int flags(0);
+    long long timeNs(0);
+    if (stream.readStream(buffs, 1000, flags, timeNs) != SOAPY_SDR_STREAM_ERROR) return false;
+    if (stream.readStream(buffs, 10, flags, timeNs) != 10 or buff[2] != 16-2048) return false;
+    printf("PASS\n");
+    return true;
+}
+
+static bool checkUnknownFormat(LoopbackDevice &device)
+{
+    printf("  Check unknown format ... ");
+    try
+    {
+        SoapySDR::ConvertingStream stream(&device, SOAPY_SDR_RX, "FOO");
+        return false;
+    }
+    catch (const std::exception &)
+    {
+        //the native stream is not opened
+        if (device.numOpen != 0) return false;
+    }
+    printf("PASS\n");
+    return true;
+}
+
+int main(void)
+{
+    LoopbackDevice device;
+    printf("Check converting streams:\n");
+    if (not checkRead(device)) return EXIT_FAILURE;
+    if (not checkWrite(device)) return EXIT_FAILURE;
+    if (not checkPassThrough(device)) return EXIT_FAILURE;
+    if (not checkUnknownFormat(device)) return EXIT_FAILURE;
+    if (device.numOpen != 0) return EXIT_FAILURE;
+    printf("DONE!\n");
+    return EXIT_SUCCESS;
+}
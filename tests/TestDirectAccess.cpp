@@ -0,0 +1,338 @@
+// Copyright (c) 2021-2021 Josh Blum
+// SPDX-License-Identifier: BSL-1.0
+
+#include <SoapySDR/DirectAccess.hpp>
+#include <SoapySDR/Formats.hpp>
+#include <SoapySDR/Time.hpp>
+#include <cstdlib>
+#include <cstdio>
+#include <cstdint>
+#include <algorithm>
+#include <vector>
+#include <atomic>
+#include <thread>
+#include <chrono>
+
+//! A device with direct access to CS16 buffers of 100 elements, which counts the acquired buffers
+class DMADevice : public SoapySDR::Device
+{
+public:
+    static const size_t BUFF_SIZE = 100;
+    static const long long TIME_NS = 1000000;
+
+    DMADevice(void):
+        rxBuff(BUFF_SIZE*2),
+        txBuff(BUFF_SIZE*2)
+    {
+        for (size_t i = 0; i < BUFF_SIZE; i++)
+        {
+            rxBuff[i*2+0] = int16_t(i*256);
+            rxBuff[i*2+1] = int16_t(-int(i));
+        }
+    }
+
+    size_t getNumDirectAccessBuffers(SoapySDR::Stream *)
+    {
+        return 8;
+    }
+
+    //each buffer ends a burst
+    int acquireReadBuffer(SoapySDR::Stream *, size_t &handle, const void **buffs, int &flags, long long &timeNs, const long)
+    {
+        if (numRxHeld != 0) return SOAPY_SDR_STREAM_ERROR;
+        numRxHeld++;
+        handle = 3;
+        buffs[0] = rxBuff.data();
+        flags = SOAPY_SDR_HAS_TIME | SOAPY_SDR_END_BURST;
+        timeNs = TIME_NS;
+        return int(BUFF_SIZE);
+    }
+
+    void releaseReadBuffer(SoapySDR::Stream *, const size_t handle)
+    {
+        if (handle == 3) numRxHeld--;
+    }
+
+    int acquireWriteBuffer(SoapySDR::Stream *, size_t &handle, void **buffs, const long)
+    {
+        if (numTxHeld != 0) return SOAPY_SDR_STREAM_ERROR;
+        numTxHeld++;
+        handle = 5;
+        buffs[0] = txBuff.data();
+        return int(BUFF_SIZE);
+    }
+
+    void releaseWriteBuffer(SoapySDR::Stream *, const size_t handle, const size_t numElems, int &flags, const long long)
+    {
+        if (handle == 5) numTxHeld--;
+        written.insert(written.end(), txBuff.begin(), txBuff.begin()+numElems*2);
+        writtenFlags.push_back(flags);
+    }
+
+    std::vector<int16_t> rxBuff, txBuff;
+    int numRxHeld = 0;
+    int numTxHeld = 0;
+    std::vector<int16_t> written;
+    std::vector<int> writtenFlags;
+};
+
+static bool checkFragments(DMADevice &device)
+{
+    printf("  Check CF32 read fragments ... ");
+    const double rate = 1e6;
+    SoapySDR::DirectAccessReader reader(&device, nullptr, 1, SOAPY_SDR_CS16, SOAPY_SDR_CF32);
+    reader.setSampleRate(rate);
+
+    //one buffer is read in fragments of 30 elements
+    std::vector<float> buff(DMADevice::BUFF_SIZE*2);
+    size_t offset = 0;
+    for (const int expected : {30, 30, 30, 10})
+    {
+        void *buffs[] = {buff.data()+offset*2};
+        int flags(0);
+        long long timeNs(0);
+        const int ret = reader.readStream(buffs, 30, flags, timeNs);
+        if (ret != expected) return false;
+        const bool last = (offset+ret == DMADevice::BUFF_SIZE);
+        const int expectedFlags = SOAPY_SDR_HAS_TIME | (last?SOAPY_SDR_END_BURST:SOAPY_SDR_MORE_FRAGMENTS);
+        if (flags != expectedFlags) return false;
+        if (timeNs != DMADevice::TIME_NS + SoapySDR::ticksToTimeNs(offset, rate)) return false;
+        if (device.numRxHeld != (last?0:1)) return false;
+        offset += ret;
+    }
+
+    //every element is converted from the buffer
+    for (size_t i = 0; i < DMADevice::BUFF_SIZE; i++)
+    {
+        if (buff[i*2+0] != (i*256)/32768.0f or buff[i*2+1] != -float(i)/32768) return false;
+    }
+    printf("PASS\n");
+    return true;
+}
+
+static bool checkNativeRead(DMADevice &device)
+{
+    printf("  Check native CS16 read ... ");
+    {
+        //without a rate, only the first fragment has a time
+        SoapySDR::DirectAccessReader reader(&device, nullptr, 1, SOAPY_SDR_CS16, SOAPY_SDR_CS16);
+        std::vector<int16_t> buff(DMADevice::BUFF_SIZE*2);
+        void *buffs[] = {buff.data()};
+        int flags(0);
+        long long timeNs(0);
+        if (reader.readStream(buffs, 60, flags, timeNs) != 60) return false;
+        if (flags != (SOAPY_SDR_HAS_TIME | SOAPY_SDR_MORE_FRAGMENTS)) return false;
+        buffs[0] = buff.data()+60*2;
+        if (reader.readStream(buffs, 60, flags, timeNs) != 40) return false;
+        if (flags != SOAPY_SDR_END_BURST) return false;
+        if (buff != device.rxBuff) return false;
+
+        //the held buffer is released when the reader is destroyed
+        buffs[0] = buff.data();
+        if (reader.readStream(buffs, 10, flags, timeNs) != 10) return false;
+        if (device.numRxHeld != 1) return false;
+    }
+    if (device.numRxHeld != 0) return false;
+    printf("PASS\n");
+    return true;
+}
+
+static bool checkWrite(DMADevice &device)
+{
+    printf("  Check CF32 write ... ");
+    SoapySDR::DirectAccessWriter writer(&device, nullptr, 1, SOAPY_SDR_CS16, SOAPY_SDR_CF32);
+    std::vector<float> buff(150*2);
+    for (size_t i = 0; i < buff.size(); i++) buff[i] = (int(i)-150)/32768.0f;
+
+    //the end of burst is held back until the last element is written
+    const void *buffs[] = {buff.data()};
+    int flags(SOAPY_SDR_END_BURST);
+    if (writer.writeStream(buffs, 150, flags) != int(DMADevice::BUFF_SIZE)) return false;
+    buffs[0] = buff.data()+DMADevice::BUFF_SIZE*2;
+    flags = SOAPY_SDR_END_BURST;
+    if (writer.writeStream(buffs, 50, flags) != 50) return false;
+    if (device.numTxHeld != 0) return false;
+    if (device.writtenFlags != std::vector<int>({0, SOAPY_SDR_END_BURST})) return false;
+
+    if (device.written.size() != buff.size()) return false;
+    for (size_t i = 0; i < buff.size(); i++)
+    {
+        if (device.written[i] != int(i)-150) return false;
+    }
+    printf("PASS\n");
+    return true;
+}
+
+//! A device with CS16 streams and no direct access, which reads a counter and writes up to 30 elements per call
+class StreamDevice : public SoapySDR::Device
+{
+public:
+    static const size_t MTU = 64;
+
+    size_t getStreamMTU(SoapySDR::Stream *) const
+    {
+        return MTU;
+    }
+
+    int activateStream(SoapySDR::Stream *, const int, const long long, const size_t)
+    {
+        return 0;
+    }
+
+    int deactivateStream(SoapySDR::Stream *, const int, const long long)
+    {
+        return 0;
+    }
+
+    //the third read overflows, and the reads from failAt fail
+    int readStream(SoapySDR::Stream *, void * const *buffs, const size_t numElems, int &flags, long long &timeNs, const long)
+    {
+        const int n = ++numReads;
+        if (failAt != 0 and n >= failAt) return SOAPY_SDR_STREAM_ERROR;
+        if (n == 3) return SOAPY_SDR_OVERFLOW;
+        auto *out = (int16_t *)buffs[0];
+        flags = SOAPY_SDR_HAS_TIME;
+        timeNs = count;
+        for (size_t i = 0; i < numElems*2; i++) out[i] = int16_t(count++);
+        return int(numElems);
+    }
+
+    int writeStream(SoapySDR::Stream *, const void * const *buffs, const size_t numElems, int &flags, const long long, const long)
+    {
+        const size_t n = std::min<size_t>(numElems, 30);
+        const auto *in = (const int16_t *)buffs[0];
+        written.insert(written.end(), in, in+n*2);
+        writtenFlags.push_back(flags);
+        return int(n);
+    }
+
+    std::atomic<int> numReads{0};
+    int failAt = 0;
+    int count = 0;
+    std::vector<int16_t> written;
+    std::vector<int> writtenFlags;
+};
+
+static bool checkRingRead(StreamDevice &device)
+{
+    printf("  Check emulated ring read ... ");
+    SoapySDR::DirectAccessRing ring(&device, nullptr, SOAPY_SDR_RX, 1, SOAPY_SDR_CS16, 4);
+    if (not ring.isEmulated() or ring.getNumDirectAccessBuffers() != 4) return false;
+    if (ring.activateStream() != 0) return false;
+
+    //the buffers are filled in order and the overflow comes between them
+    int expected = 0;
+    for (const int expectedRet : {int(StreamDevice::MTU), int(StreamDevice::MTU), SOAPY_SDR_OVERFLOW, int(StreamDevice::MTU)})
+    {
+        size_t handle(0);
+        const void *buffs[1] = {};
+        int flags(0);
+        long long timeNs(0);
+        const int ret = ring.acquireReadBuffer(handle, buffs, flags, timeNs, 1000000);
+        if (ret != expectedRet) return false;
+        if (ret < 0) continue;
+
+        void *addrs[1] = {};
+        if (ring.getDirectAccessBufferAddrs(handle, addrs) != 0 or addrs[0] != buffs[0]) return false;
+        if ((size_t(buffs[0]) % 64) != 0) return false;
+        if (flags != SOAPY_SDR_HAS_TIME or timeNs != expected) return false;
+        const auto *in = (const int16_t *)buffs[0];
+        for (int i = 0; i < ret*2; i++)
+        {
+            if (in[i] != int16_t(expected++)) return false;
+        }
+        ring.releaseReadBuffer(handle);
+    }
+    if (ring.deactivateStream() != 0) return false;
+    printf("PASS\n");
+    return true;
+}
+
+static bool checkRingError(void)
+{
+    printf("  Check emulated ring read error ... ");
+    StreamDevice device;
+    device.failAt = 4;
+    SoapySDR::DirectAccessRing ring(&device, nullptr, SOAPY_SDR_RX, 1, SOAPY_SDR_CS16, 4);
+    if (ring.activateStream() != 0) return false;
+
+    //the overflow is recycled, and the stream error stops the thread
+    for (const int expectedRet : {int(StreamDevice::MTU), int(StreamDevice::MTU), SOAPY_SDR_OVERFLOW, SOAPY_SDR_STREAM_ERROR, SOAPY_SDR_STREAM_ERROR})
+    {
+        size_t handle(0);
+        const void *buffs[1] = {};
+        int flags(0);
+        long long timeNs(0);
+        const int ret = ring.acquireReadBuffer(handle, buffs, flags, timeNs, 1000000);
+        if (ret != expectedRet) return false;
+        if (ret >= 0) ring.releaseReadBuffer(handle);
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    if (device.numReads != 4) return false;
+    if (ring.deactivateStream() != 0) return false;
+    printf("PASS\n");
+    return true;
+}
+
+static bool checkRingWrite(StreamDevice &device)
+{
+    printf("  Check emulated ring write ... ");
+    SoapySDR::DirectAccessRing ring(&device, nullptr, SOAPY_SDR_TX, 1, SOAPY_SDR_CS16, 2, 50);
+    if (ring.activateStream() != 0) return false;
+
+    //one buffer of 50 elements takes two partial writes
+    size_t handle(0);
+    void *buffs[1] = {};
+    if (ring.acquireWriteBuffer(handle, buffs) != 50) return false;
+    auto *out = (int16_t *)buffs[0];
+    for (int i = 0; i < 50*2; i++) out[i] = int16_t(i);
+    int flags(SOAPY_SDR_HAS_TIME | SOAPY_SDR_END_BURST);
+    ring.releaseWriteBuffer(handle, 50, flags, 1000);
+
+    //the released buffers are written before the thread stops
+    if (ring.deactivateStream() != 0) return false;
+    if (device.writtenFlags != std::vector<int>({SOAPY_SDR_HAS_TIME | SOAPY_SDR_END_BURST, SOAPY_SDR_END_BURST})) return false;
+    if (device.written.size() != 50*2) return false;
+    for (int i = 0; i < 50*2; i++)
+    {
+        if (device.written[i] != i) return false;
+    }
+    printf("PASS\n");
+    return true;
+}
+
+static bool checkRingPassThrough(DMADevice &device)
+{
+    printf("  Check direct access ring ... ");
+    SoapySDR::DirectAccessRing ring(&device, nullptr, SOAPY_SDR_RX, 1, SOAPY_SDR_CS16);
+    if (ring.isEmulated() or ring.getNumDirectAccessBuffers() != 8) return false;
+
+    //the driver buffers are acquired without a copy
+    size_t handle(0);
+    const void *buffs[1] = {};
+    int flags(0);
+    long long timeNs(0);
+    if (ring.acquireReadBuffer(handle, buffs, flags, timeNs) != int(DMADevice::BUFF_SIZE)) return false;
+    if (handle != 3 or buffs[0] != device.rxBuff.data()) return false;
+    ring.releaseReadBuffer(handle);
+    if (device.numRxHeld != 0) return false;
+    printf("PASS\n");
+    return true;
+}
+
+int main(void)
+{
+    DMADevice device;
+    printf("Check direct access streams:\n");
+    if (not checkFragments(device)) return EXIT_FAILURE;
+    if (not checkNativeRead(device)) return EXIT_FAILURE;
+    if (not checkWrite(device)) return EXIT_FAILURE;
+    if (not checkRingPassThrough(device)) return EXIT_FAILURE;
+
+    StreamDevice streamDevice;
+    if (not checkRingRead(streamDevice)) return EXIT_FAILURE;
+    if (not checkRingWrite(streamDevice)) return EXIT_FAILURE;
+    if (not checkRingError()) return EXIT_FAILURE;
+    printf("DONE!\n");
+    return EXIT_SUCCESS;
+}
@@ -4,6 +4,7 @@
 #include <SoapySDR/Formats.hpp>
 #include <cstdlib>
 #include <cstdio>
+#include <string>
 
 int main(void)
 {
@@ -41,6 +42,44 @@ int main(void)
     formatCheck(SOAPY_SDR_S8, 1);
     formatCheck(SOAPY_SDR_U8, 1);
 
+    #define descriptorCheck(formatStr, expectedBits, expectedComplex, expectedFloat, expectedSigned, expectedBigEndian) \
+    { \
+        const auto desc = SoapySDR::formatToDescriptor(formatStr); \
+        printf("%s -> id %u, %d bits\t", formatStr, desc.id, int(desc.bitDepth)); \
+        if (desc.id == 0 or std::string(desc.format) != formatStr or \
+            desc.size != SoapySDR::formatToSize(formatStr) or desc.bitDepth != expectedBits or \
+            desc.isComplex != expectedComplex or desc.isFloat != expectedFloat or \
+            desc.isSigned != expectedSigned or desc.isBigEndian != expectedBigEndian) \
+        { \
+            printf("FAIL: unexpected descriptor!\n"); \
+            return EXIT_FAILURE; \
+        } \
+        else printf("OK\n"); \
+    }
+
+    descriptorCheck(SOAPY_SDR_CF64, 64, true, true, true, false);
+    descriptorCheck(SOAPY_SDR_CS16, 16, true, false, true, false);
+    descriptorCheck(SOAPY_SDR_CU12, 12, true, false, false, false);
+    descriptorCheck(SOAPY_SDR_CS16BE, 16, true, false, true, true);
+    descriptorCheck(SOAPY_SDR_F32, 32, false, true, true, false);
+    descriptorCheck(SOAPY_SDR_U8, 8, false, false, false, false);
+    descriptorCheck(SOAPY_SDR_S32BE, 32, false, false, true, true);
+
+    //interned IDs are stable and map back to the same descriptor
+    const auto cs16 = SoapySDR::formatToDescriptor(SOAPY_SDR_CS16);
+    const auto cs16Again = SoapySDR::formatToDescriptor(std::string("CS") + "16");
+    const auto fromId = SoapySDR::formatIdToDescriptor(cs16.id);
+    if (cs16Again.id != cs16.id or cs16Again.format != cs16.format) return EXIT_FAILURE;
+    if (fromId.id != cs16.id or fromId.format != cs16.format) return EXIT_FAILURE;
+    if (SoapySDR::formatToDescriptor(SOAPY_SDR_CS8).id == cs16.id) return EXIT_FAILURE;
+    if (SoapySDR::formatToSize(cs16) != 4) return EXIT_FAILURE;
+
+    //empty formats and unknown IDs have no ID
+    if (SoapySDR::formatToDescriptor("").id != 0) return EXIT_FAILURE;
+    if (SoapySDR_formatToDescriptor(nullptr).id != 0) return EXIT_FAILURE;
+    if (SoapySDR::formatIdToDescriptor(0).id != 0) return EXIT_FAILURE;
+    if (SoapySDR::formatIdToDescriptor(100000).id != 0) return EXIT_FAILURE;
+
     printf("DONE!\n");
     return EXIT_SUCCESS;
 }
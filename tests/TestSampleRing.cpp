@@ -0,0 +1,164 @@
+// Copyright (c) 2021-2021 Josh Blum
+// SPDX-License-Identifier: BSL-1.0
+
+#include <SoapySDR/SampleRing.hpp>
+#include <SoapySDR/Constants.h>
+#include <cstdlib>
+#include <cstdio>
+#include <cstdint>
+#include <thread>
+#include <stdexcept>
+
+static bool checkOverflow(void)
+{
+    printf("  Check overflow ... ");
+    SoapySDR::SampleRing ring(2, 4, 16, sizeof(int16_t)*2);
+    void *buffs[2] = {};
+    const void *readBuffs[2] = {};
+    int flags(0);
+    long long timeNs(0);
+
+    //the fifth and sixth blocks are dropped when the ring is full
+    for (int i = 0; i < 6; i++)
+    {
+        if (ring.acquireWrite(buffs) != (i < 4)) return false;
+        if (i >= 4) continue;
+        if ((size_t(buffs[0]) % SoapySDR::SampleRing::ALIGNMENT) != 0) return false;
+        if ((size_t(buffs[1]) % SoapySDR::SampleRing::ALIGNMENT) != 0) return false;
+        ring.commitWrite(16, SOAPY_SDR_HAS_TIME, i);
+    }
+    if (ring.getNumOverflows() != 2) return false;
+
+    //a block is freed and the seventh block follows the dropped blocks
+    if (ring.acquireRead(readBuffs, flags, timeNs) != 16 or timeNs != 0) return false;
+    ring.releaseRead();
+    if (not ring.acquireWrite(buffs)) return false;
+    ring.commitWrite(8, SOAPY_SDR_HAS_TIME, 6);
+
+    //the overflow is read in order, once, before the seventh block
+    for (const long long expected : {1, 2, 3, -1, 6})
+    {
+        const int ret = ring.acquireRead(readBuffs, flags, timeNs);
+        if (expected < 0)
+        {
+            if (ret != SOAPY_SDR_OVERFLOW) return false;
+            continue;
+        }
+        if (ret != ((expected == 6)?8:16) or flags != SOAPY_SDR_HAS_TIME or timeNs != expected) return false;
+        ring.releaseRead();
+    }
+
+    //an empty ring times out
+    if (ring.acquireRead(readBuffs, flags, timeNs, 1000) != SOAPY_SDR_TIMEOUT) return false;
+    if (ring.acquireRead(readBuffs, flags, timeNs, 0) != SOAPY_SDR_TIMEOUT) return false;
+    printf("PASS\n");
+    return true;
+}
+
+static bool checkOverflowRelease(void)
+{
+    printf("  Check read after overflow ... ");
+    SoapySDR::SampleRing ring(1, 2, 4, sizeof(int));
+    void *buffs[1] = {};
+    const void *readBuffs[1] = {};
+    int flags(0);
+    long long timeNs(0);
+
+    //the third block is dropped, and the fourth block carries the overflow
+    for (int i = 0; i < 3; i++)
+    {
+        if (ring.acquireWrite(buffs) != (i < 2)) return false;
+        if (i < 2) ring.commitWrite(4, 0, i);
+    }
+    if (ring.acquireRead(readBuffs, flags, timeNs) != 4 or timeNs != 0) return false;
+    ring.releaseRead();
+    if (not ring.acquireWrite(buffs)) return false;
+    void *fourth = buffs[0];
+    ring.commitWrite(2, 0, 3);
+    if (ring.acquireRead(readBuffs, flags, timeNs) != 4 or timeNs != 1) return false;
+    ring.releaseRead();
+
+    //the overflow is not released, the next call gets the fourth block
+    if (ring.acquireRead(readBuffs, flags, timeNs) != SOAPY_SDR_OVERFLOW) return false;
+    if (ring.acquireRead(readBuffs, flags, timeNs) != 2 or timeNs != 3 or readBuffs[0] != fourth) return false;
+    ring.releaseRead();
+    if (ring.acquireRead(readBuffs, flags, timeNs, 0) != SOAPY_SDR_TIMEOUT) return false;
+
+    //a ring without blocks is rejected
+    bool threw = false;
+    try
+    {
+        SoapySDR::SampleRing empty(1, 0, 4, sizeof(int));
+    }
+    catch (const std::invalid_argument &)
+    {
+        threw = true;
+    }
+    if (not threw) return false;
+    printf("PASS\n");
+    return true;
+}
+
+static bool checkThreads(void)
+{
+    printf("  Check producer and consumer threads ... ");
+    const int numBlocks = 20000;
+    const size_t blockElems = 8;
+    SoapySDR::SampleRing ring(1, 8, blockElems, sizeof(int));
+
+    //the producer drops the blocks which do not fit
+    std::thread producer([&ring]{
+        for (int i = 0; i < numBlocks; i++)
+        {
+            if (i % 4 == 0) std::this_thread::yield();
+            void *buffs[1] = {};
+            if (not ring.acquireWrite(buffs)) continue;
+            auto *out = (int *)buffs[0];
+            for (size_t j = 0; j < blockElems; j++) out[j] = i;
+            ring.commitWrite(blockElems, SOAPY_SDR_HAS_TIME, i);
+        }
+    });
+
+    //every gap in the blocks is reported by an overflow
+    int last(-1);
+    size_t numDropped(0);
+    bool overflowed(false), ok(true);
+    while (true)
+    {
+        const void *buffs[1] = {};
+        int flags(0);
+        long long timeNs(0);
+        const int ret = ring.acquireRead(buffs, flags, timeNs, 100000);
+        if (ret == SOAPY_SDR_TIMEOUT) break;
+        if (ret == SOAPY_SDR_OVERFLOW and not overflowed)
+        {
+            overflowed = true;
+            continue;
+        }
+        if (ret != int(blockElems) or timeNs <= last) {ok = false; break;}
+        const auto *in = (const int *)buffs[0];
+        for (size_t j = 0; j < blockElems; j++) if (in[j] != timeNs) ok = false;
+        if ((timeNs != last+1) != overflowed) ok = false;
+        numDropped += size_t(timeNs-last-1);
+        overflowed = false;
+        last = int(timeNs);
+        ring.releaseRead();
+    }
+    producer.join();
+
+    //the blocks dropped at the end have no later block to report them
+    numDropped += size_t(numBlocks-1-last);
+    if (not ok or numDropped != ring.getNumOverflows()) return false;
+    printf("PASS (%d dropped)\n", int(numDropped));
+    return true;
+}
+
+int main(void)
+{
+    printf("Check sample ring:\n");
+    if (not checkOverflow()) return EXIT_FAILURE;
+    if (not checkOverflowRelease()) return EXIT_FAILURE;
+    if (not checkThreads()) return EXIT_FAILURE;
+    printf("DONE!\n");
+    return EXIT_SUCCESS;
+}